@@ -5,25 +5,59 @@
 #include <stdint.h>
 #include "TM4C123.h"
 
+#include "soft_timer.h"
+#include "timebase.h"
+#include "wait.h"
+#include "isr_stats.h"
+#include "spsc.h"
+#include "kernel.h"
+#include "event_loop.h"
+#include "atomic.h"
+
 extern void Timer5_Init(void);
-extern void Timer5_DelayMs(uint32_t ms);
 extern void Timer5_DelayUs(uint32_t us);
 
 // Pins configuration for HC-SR04
 #define TRIG_PIN 0x04  // PF2 for Trig
 #define ECHO_PIN 0x10  // PC4 for Echo
 
-// Global variables for pulse measurement
-volatile uint32_t risingEdge = 0;
-volatile uint32_t fallingEdge = 0;
-volatile uint32_t pulseWidth = 0;
-volatile uint32_t distance = 200; // Default distance (in cm)
+#define DISTANCE_NO_ECHO 0xFFFF   // Distance reported when no fresh echo arrived
+
+// One completed echo, published by WTIMER0A_Handler through echoRing
+typedef struct {
+    uint32_t seq;          // Increments by one per echo; a gap means records were dropped
+    uint32_t pulseWidth;   // Echo high time, timer ticks
+    uint32_t distance;     // cm
+    uint64_t timestamp;    // Timebase us of the falling edge
+} EchoRecord;
+
+SPSC_DEFINE(echoRing, EchoRecord, 8);
+static uint32_t echoSeq = 0;
+
+// Latest echo and trigger time as consistent snapshots; each has one writer
+// (the echo ISR, the ranging task) and is read through its seqlock
+static EchoRecord echoLatest = { 0, 0, 200, 0 };   // Default distance 200 cm
+static SeqLock echoLatestLock;
+static uint64_t triggerTime = 0;                   // Timebase us of the last trigger pulse
+static SeqLock triggerTimeLock;
+
+#define RANGE_ECHO_MS 15   // Longest wait for the echo after a trigger
+
+static Semaphore rangeRequest = KERNEL_SEM_INIT(0, 1);   // Posted by DistanceSensor_RequestRange
+static uint32_t rangeNoEcho = 0;                          // Echo windows that timed out
+static volatile EventType rangeDoneEvent = EVT_NONE;      // Posted when the ranging finishes
 
 // Function prototypes
 void DistanceSensor_Init(void);
 void TimerWT0_Init(void);
 void TriggerPulse(void);
 void WTIMER0A_Handler(void);
+void WTIMER0B_Handler(void);
+void DistanceSensor_Latest(EchoRecord *echo);
+uint64_t DistanceSensor_TriggerTime(void);
+uint8_t DistanceSensor_TakeEcho(uint64_t sinceUs, EchoRecord *echo);
+void DistanceSensor_RequestRange(EventType doneEvent);
+void DistanceSensor_Task(void *arg);
 
 // Initialize the distance sensor (Trig: PF2, Echo: PC4)
 void DistanceSensor_Init(void) {
@@ -58,6 +92,7 @@ void TimerWT0_Init(void) {
 
     //NVIC->ISER[0] |= (1 << 94);  // Enable IRQ 94 for Wide Timer 0A
 		NVIC_EnableIRQ(WTIMER0A_IRQn);
+		NVIC_EnableIRQ(WTIMER0B_IRQn);  // Timer B is unused: software-pended echo notification
 }
 
 // Trigger a pulse for HC-SR04
@@ -67,29 +102,113 @@ void TriggerPulse(void) {
     GPIOF->DATA |= TRIG_PIN;  // Set Trig high
     Timer5_DelayUs(10);       // Send 10 microseconds pulse using Timer5
     GPIOF->DATA &= ~TRIG_PIN; // Set Trig low
+
+    uint64_t now = Timebase_NowUs();
+    SeqLock_WriteBegin(&triggerTimeLock);
+    triggerTime = now;
+    SeqLock_WriteEnd(&triggerTimeLock);
 }
 
 // Wide Timer 0A ISR (handles Echo pin signal capture)
+// Runs above the BASEPRI level (atomic.h), so it only uses lock-free
+// primitives and leaves the kernel post to WTIMER0B_Handler.
 void WTIMER0A_Handler(void) {
+    ISR_STATS_ENTER(ISR_WTIMER0A);
+    ISR_STATS_LATENCY(ISR_WTIMER0A, WTIMER0->TAV - WTIMER0->TAR);  // Capture edge to now, in cycles
     static int is_rising_edge = 1;
+    static uint32_t risingEdge;
 
     if (is_rising_edge) {
         risingEdge = WTIMER0->TAR;  // Capture the rising edge
         is_rising_edge = 0;
     } else {
-        fallingEdge = WTIMER0->TAR;  // Capture the falling edge
-
-        if (fallingEdge >= risingEdge) {
-            pulseWidth = fallingEdge - risingEdge;
-        } else {
-            pulseWidth = (0xFFFFFFFF - risingEdge) + fallingEdge;  // Handle Timer overflow
-        }
-
-        distance = pulseWidth * 0.001071875;  // Convert pulse width to distance in cm
+        uint32_t fallingEdge = WTIMER0->TAR;  // Capture the falling edge
+        uint32_t pulseWidth = fallingEdge - risingEdge;  // Modulo 2^32, so a timer wrap is handled
+
+        EchoRecord rec;
+        rec.seq = echoSeq++;
+        rec.pulseWidth = pulseWidth;
+        rec.distance = (pulseWidth / Clock_TicksPerUs()) * 343 / 20000;  // Echo us to cm: 343 m/s, there and back
+        rec.timestamp = Timebase_NowUs();
+
+        Spsc_Push(&echoRing, &rec);
+        SeqLock_WriteBegin(&echoLatestLock);
+        echoLatest = rec;
+        SeqLock_WriteEnd(&echoLatestLock);
+        NVIC_SetPendingIRQ(WTIMER0B_IRQn);   // Wake the ranging task from below the BASEPRI level
         is_rising_edge = 1;
     }
 
     WTIMER0->ICR |= 0x04; // Clear capture event flag
+    ISR_STATS_EXIT(ISR_WTIMER0A);
+}
+
+// Software-pended by WTIMER0A_Handler: tell the ranging task the echo is in
+void WTIMER0B_Handler(void) {
+    Wait_Signal(WAIT_EVT_ECHO);
+}
+
+// Copy of the most recent echo
+void DistanceSensor_Latest(EchoRecord *echo) {
+    uint32_t seq;
+    do {
+        seq = SeqLock_ReadBegin(&echoLatestLock);
+        *echo = echoLatest;
+    } while (SeqLock_ReadRetry(&echoLatestLock, seq));
+}
+
+// Timebase us of the most recent trigger pulse
+uint64_t DistanceSensor_TriggerTime(void) {
+    uint32_t seq;
+    uint64_t t;
+    do {
+        seq = SeqLock_ReadBegin(&triggerTimeLock);
+        t = triggerTime;
+    } while (SeqLock_ReadRetry(&triggerTimeLock, seq));
+    return t;
+}
+
+// Drain the echo ring and return the newest echo that completed at or after
+// sinceUs (normally the trigger time). Older records are stale and discarded.
+// Returns 0 if no fresh echo arrived.
+uint8_t DistanceSensor_TakeEcho(uint64_t sinceUs, EchoRecord *echo) {
+    EchoRecord rec;
+    uint8_t found = 0;
+
+    while (Spsc_Pop(&echoRing, &rec)) {
+        if (rec.timestamp >= sinceUs) {
+            *echo = rec;
+            found = 1;
+        }
+    }
+    return found;
+}
+
+// ==================== Ranging Task ====================
+// The highest-priority task: fires the trigger as soon as a range is
+// requested and reports the end of the echo window without waiting behind
+// LCD or UART work. The result is read with DistanceSensor_TakeEcho().
+
+// Ask the ranging task for one measurement; doneEvent is posted when the
+// echo has arrived or RANGE_ECHO_MS has passed
+void DistanceSensor_RequestRange(EventType doneEvent) {
+    rangeDoneEvent = doneEvent;
+    Kernel_SemPost(&rangeRequest);
+}
+
+// Ranging task
+void DistanceSensor_Task(void *arg) {
+    (void)arg;
+
+    while (1) {
+        Kernel_SemWait(&rangeRequest, KERNEL_WAIT_FOREVER);
+        Wait_Clear(WAIT_EVT_ECHO);    // Forget echoes from earlier triggers
+        TriggerPulse();
+        if (Wait_For(WAIT_EVT_ECHO, RANGE_ECHO_MS) == WAIT_TIMEOUT) {
+            rangeNoEcho++;
+        }
+        EventLoop_Post(rangeDoneEvent, 0);
+    }
 }
 
 #endif // DISTANCESENSOR_H
@@ -5,8 +5,10 @@
 #include "tm4c123gh6pm.h"
 #include "TM4C123.h"
 
+#include "soft_timer.h"
+#include "wait.h"
+
 extern void Timer5_Init(void);
-extern void Timer5_DelayMs(uint32_t ms);
 extern void Timer5_DelayUs(uint32_t us);
 
 // Define GPIO pins for speaker and power LED
@@ -18,6 +20,7 @@ void LedSpeaker_Init(void);
 void TurnOnPowerLED(void);
 void TurnOffPowerLED(void);
 void PlaySquareWave(uint32_t frequency, uint32_t duration);
+void StopSquareWave(void);
 
 // Initialize GPIO for power LED and speaker
 void LedSpeaker_Init(void) {
@@ -40,14 +43,38 @@ void TurnOffPowerLED(void) {
     GPIOB->DATA &= ~POWER_LED_PIN;
 }
 
-// Play a square wave on the speaker
-void PlaySquareWave(uint32_t frequency, uint32_t duration) {
-    uint32_t halfPeriod = 1000000 / (2 * frequency);  // Half period in microseconds
+static SoftTimer speakerTimer;      // Periodic timer toggling the speaker pin
+static SoftTimer speakerStopTimer;  // One-shot timer ending the tone
 
-    for (uint32_t i = 0; i < (duration * 1000) / (2 * halfPeriod); i++) {
-        GPIOB->DATA ^= SPEAKER_PIN;  // Toggle PB0
-        Timer5_DelayUs(halfPeriod);  // Delay for half period
+// Speaker timer callback: one half period elapsed
+static void Speaker_Toggle(void *arg) {
+    if (Wait_Pending(WAIT_EVT_CANCEL)) {  // Cancelled: stop at the next edge
+        StopSquareWave();
+        return;
     }
+    GPIOB->DATA ^= SPEAKER_PIN;  // Toggle PB0
+}
+
+// Speaker stop timer callback: tone duration elapsed
+static void Speaker_Stop(void *arg) {
+    StopSquareWave();
+}
+
+// Play a square wave on the speaker for duration ms. Returns immediately;
+// the pin is toggled from the timer ISR and the tone stops by itself.
+void PlaySquareWave(uint32_t frequency, uint32_t duration) {
+    if (frequency == 0) return;  // Nothing audible to play
+
+    uint32_t halfPeriod = (SOFTTIMER_TICKS_PER_US * 1000000) / (2 * frequency);  // Half period in ticks
+
+    SoftTimer_Start(&speakerTimer, halfPeriod, halfPeriod, Speaker_Toggle, 0);
+    SoftTimer_StartMs(&speakerStopTimer, duration, 0, Speaker_Stop, 0);
+}
+
+// Silence the speaker immediately
+void StopSquareWave(void) {
+    SoftTimer_Stop(&speakerTimer);
+    SoftTimer_Stop(&speakerStopTimer);
 
     // Ensure the speaker is off after playing the sound
     GPIOB->DATA &= ~SPEAKER_PIN;
@@ -53,6 +53,7 @@
 // back light    (LED, pin 8) not connected, consists of 4 white LEDs which draw ~80mA total
 #include <stdint.h>
 #include "Nokia5110.h"
+#include "main_api.h"                   // Atomic_*, Udma_*, Kernel_* from main.c
 // *************************** Screen dimensions ***************************
 #define SCREENW     84
 #define SCREENH     48
@@ -73,6 +74,9 @@
 #define SSI0_DR_R               (*((volatile uint32_t *)0x40008008))
 #define SSI0_SR_R               (*((volatile uint32_t *)0x4000800C))
 #define SSI0_CPSR_R             (*((volatile uint32_t *)0x40008010))
+#define SSI0_IM_R               (*((volatile uint32_t *)0x40008014))
+#define SSI0_RIS_R              (*((volatile uint32_t *)0x40008018))
+#define SSI0_DMACTL_R           (*((volatile uint32_t *)0x40008024))
 #define SSI0_CC_R               (*((volatile uint32_t *)0x40008FC8))
 #define SSI_CR0_SCR_M           0x0000FF00  // SSI Serial Clock Rate
 #define SSI_CR0_SPH             0x00000080  // SSI Serial Clock Phase
@@ -81,12 +85,18 @@
 #define SSI_CR0_FRF_MOTO        0x00000000  // Freescale SPI Frame Format
 #define SSI_CR0_DSS_M           0x0000000F  // SSI Data Size Select
 #define SSI_CR0_DSS_8           0x00000007  // 8-bit data
+#define SSI_CR1_EOT             0x00000010  // End of Transmission
 #define SSI_CR1_MS              0x00000004  // SSI Master/Slave Select
 #define SSI_CR1_SSE             0x00000002  // SSI Synchronous Serial Port
                                             // Enable
 #define SSI_SR_BSY              0x00000010  // SSI Busy Bit
 #define SSI_SR_TNF              0x00000002  // SSI Transmit FIFO Not Full
 #define SSI_CPSR_CPSDVSR_M      0x000000FF  // SSI Clock Prescale Divisor
+#define SSI_IM_TXIM             0x00000008  // SSI Transmit FIFO Interrupt Mask
+#define SSI_RIS_TXRIS           0x00000008  // SSI Transmit FIFO Raw Interrupt
+#define SSI_DMACTL_TXDMAE       0x00000002  // Transmit DMA Enable
+#define NVIC_EN0_R              (*((volatile uint32_t *)0xE000E100))
+#define NVIC_EN0_SSI0           0x00000080  // IRQ 7
 #define SSI_CC_CS_M             0x0000000F  // SSI Baud Clock Source
 #define SSI_CC_CS_SYSPLL        0x00000000  // Either the system clock (if the
                                             // PLL bypass is in effect) or the
@@ -95,6 +105,17 @@
 #define SYSCTL_RCGC2_R          (*((volatile uint32_t *)0x400FE108))
 #define SYSCTL_RCGC1_SSI0       0x00000010  // SSI0 Clock Gating Control
 #define SYSCTL_RCGC2_GPIOA      0x00000001  // port A Clock Gating Control
+#define SSI0_MAX_HZ             4000000     // PCD8544 serial clock limit
+
+static uint8_t GlassStale = 1;          // glass written directly: next swap sends everything
+
+enum flushState{
+  FLUSH_IDLE,                           // SSI0 and D/C free for blocking writes
+  FLUSH_COMMAND,                        // address commands shifting out, D/C low
+  FLUSH_DATA,                           // uDMA feeding a span, D/C high
+  FLUSH_DRAIN                           // span queued, waiting for the FIFO to empty
+};
+static volatile uint8_t FlushState = FLUSH_IDLE;
 
 enum typeOfWrite{
   COMMAND,                              // the transmission is an LCD command
@@ -220,12 +241,24 @@ static const uint8_t ASCII[][5] = {
 // transmit FIFO, configures the Data/Command pin for data,
 // and then adds the data to the transmit FIFO.
 
+// An asynchronous flush owns SSI0 and D/C until it ends. Tasks sleep
+// through it (a full frame takes about 1 ms); before Kernel_Start it spins.
+// Task context only.
+void static waitFlushIdle(void){
+  while(FlushState != FLUSH_IDLE){
+    if(Kernel_Running()){
+      Kernel_Sleep(1);
+    }
+  }
+}
+
 // This is a helper function that sends an 8-bit message to the LCD.
 // inputs: type     COMMAND or DATA
 //         message  8-bit code to transmit
 // outputs: none
 // assumes: SSI0 and port A have already been initialized and enabled
 void static lcdwrite(enum typeOfWrite type, uint8_t message){
+  waitFlushIdle();
   if(type == COMMAND){
                                         // wait until SSI0 not busy/transmit FIFO empty
     while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
@@ -240,6 +273,7 @@ void static lcdwrite(enum typeOfWrite type, uint8_t message){
   }
 }
 void static lcddatawrite(uint8_t data){
+  waitFlushIdle();
   while((SSI0_SR_R&0x00000002)==0){}; // wait until transmit FIFO not full
   DC = DC_DATA;
   SSI0_DR_R = data;                // data out
@@ -253,9 +287,12 @@ void static lcddatawrite(uint8_t data){
 // internal oscillator.
 // inputs: none
 // outputs: none
-// assumes: system clock rate of 80 MHz
+// assumes: Clock_Init has published SystemCoreClock
 void Nokia5110_Init(void){
   volatile uint32_t delay;
+  uint32_t cpsdvsr = (SystemCoreClock + SSI0_MAX_HZ - 1)/SSI0_MAX_HZ;
+  cpsdvsr = (cpsdvsr + 1)&~1;           // CPSDVSR must be even, at least 2
+  if(cpsdvsr < 2) cpsdvsr = 2;
   SYSCTL_RCGC1_R |= SYSCTL_RCGC1_SSI0;  // activate SSI0
   SYSCTL_RCGC2_R |= SYSCTL_RCGC2_GPIOA; // activate port A
   delay = SYSCTL_RCGC2_R;               // allow time to finish activating
@@ -272,18 +309,23 @@ void Nokia5110_Init(void){
   SSI0_CR1_R &= ~SSI_CR1_MS;            // master mode
                                         // configure for system clock/PLL baud clock source
   SSI0_CC_R = (SSI0_CC_R&~SSI_CC_CS_M)+SSI_CC_CS_SYSPLL;
-                                        // clock divider for 3.33 MHz SSIClk (80 MHz PLL/24)
+                                        // clock divider for SSIClk <= 4 MHz
                                         // SysClk/(CPSDVSR*(1+SCR))
-                                        // 80/(24*(1+0)) = 3.33 MHz (slower than 4 MHz)
-  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+24; // must be even number
-  SSI0_CR0_R &= ~(SSI_CR0_SCR_M |       // SCR = 0 (3.33 Mbps data rate)
+                                        // 80/(20*(1+0)) = 4 MHz, 16/(4*(1+0)) = 4 MHz
+  SSI0_CPSR_R = (SSI0_CPSR_R&~SSI_CPSR_CPSDVSR_M)+cpsdvsr;
+  SSI0_CR0_R &= ~(SSI_CR0_SCR_M |       // SCR = 0 (SysClk/CPSDVSR data rate)
                   SSI_CR0_SPH |         // SPH = 0
                   SSI_CR0_SPO);         // SPO = 0
                                         // FRF = Freescale format
   SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_FRF_M)+SSI_CR0_FRF_MOTO;
                                         // DSS = 8-bit data
   SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_8;
+  SSI0_CR1_R |= SSI_CR1_EOT;            // TXRIS means FIFO empty and idle (asynchronous flush)
+  SSI0_IM_R = 0;
   SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
+  Udma_Init();
+  Udma_ChannelInit(UDMA_CH_SSI0TX);
+  NVIC_EN0_R = NVIC_EN0_SSI0;           // SSI0_Handler runs the asynchronous flush
 
   RESET = RESET_LOW;                    // reset the LCD to a known state
   for(delay=0; delay<10; delay=delay+1);// delay minimum 100 ns
@@ -312,6 +354,7 @@ void Nokia5110_Init(void){
 // outputs: none
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_OutChar(char data){int i;
+  GlassStale = 1;            // the glass no longer shows Front
   lcddatawrite(0x00);        // blank vertical line padding
   for(i=0; i<5; i=i+1){
     lcddatawrite(ASCII[data - 0x20][i]);
@@ -402,8 +445,20 @@ void Nokia5110_Clear(void){
     lcddatawrite(0x00);
   }
   Nokia5110_SetCursor(0, 0);
+  GlassStale = 1;                       // the glass no longer shows Front
 }
 
+// *************************** Frame buffers ***************************
+// Screen is the back buffer: everything draws into it. Front holds the frame
+// the glass shows (or is being streamed to it) and is never drawn into.
+// Outside the dirty spans the two are equal. A swap narrows each dirty span
+// to the columns that really differ, exchanges the pointers, sends those
+// spans from the new Front, and copies them into the new Screen so drawing
+// carries on from the frame just handed over.
+static uint8_t Frame[2][SCREENW*SCREENH/8];
+uint8_t *Screen = Frame[0];             // back buffer: the next image
+static uint8_t *Front = Frame[1];       // front buffer: the image on the glass
+
 //********Nokia5110_DrawFullImage*****************
 // Fill the whole screen by drawing a 48x84 bitmap image.
 // inputs: ptr  pointer to 504 byte bitmap
@@ -415,8 +470,87 @@ void Nokia5110_DrawFullImage(const uint8_t *ptr){
   for(i=0; i<(MAX_X*MAX_Y/8); i=i+1){
     lcddatawrite(ptr[i]);
   }
+  GlassStale = 1;                       // the glass shows ptr now, not Front
+}
+
+// *************************** Dirty tracking ***************************
+// For each of the six 8-pixel banks, DirtyLo..DirtyHi is the column range of
+// Screen that may differ from Front (empty when DirtyLo > DirtyHi). Drawing
+// into Screen widens the range only when a byte actually changes; a swap
+// turns the ranges into SendLo..SendHi, the spans the flush sends.
+// Writing to the glass directly (OutChar, Clear, DrawFullImage) sets
+// GlassStale, which makes the next swap send everything.
+#define BANKS                   (SCREENH/8)
+static uint8_t DirtyLo[BANKS], DirtyHi[BANKS];
+static uint8_t SendLo[BANKS], SendHi[BANKS];
+
+// Widen bank's dirty range to include columns x0..x1
+static void markDirty(uint32_t bank, uint32_t x0, uint32_t x1){
+  uint32_t state = Atomic_Enter();      // a deferred swap takes ranges in SSI0_Handler
+  if(DirtyLo[bank] > DirtyHi[bank]){   // was clean
+    DirtyLo[bank] = x0;
+    DirtyHi[bank] = x1;
+  } else{
+    if(x0 < DirtyLo[bank]) DirtyLo[bank] = x0;
+    if(x1 > DirtyHi[bank]) DirtyHi[bank] = x1;
+  }
+  Atomic_Exit(state);
+}
+
+// Store one Screen byte, marking it dirty if it changes
+static void setByte(uint32_t index, uint8_t value){
+  if(Screen[index] != value){
+    Screen[index] = value;
+    markDirty(index/SCREENW, index%SCREENW, index%SCREENW);
+  }
+}
+
+// Swap Screen and Front: the dirty ranges, trimmed of columns that
+// are already equal, become the send spans, and the new Screen gets
+// those spans from the new Front. Call with no flush running; the
+// caller does not draw until the swap is done.
+static void swapBuffers(void){
+  uint32_t bank, base, lo, hi, x, full;
+  uint8_t *frame;
+  full = GlassStale;                    // the glass may differ anywhere
+  GlassStale = 0;
+  for(bank=0; bank<BANKS; bank=bank+1){
+    base = SCREENW*bank;
+    lo = full ? 0 : DirtyLo[bank];
+    hi = full ? SCREENW-1 : DirtyHi[bank];
+    if(!full){
+      while((lo <= hi) && (Screen[base+lo] == Front[base+lo])) lo = lo + 1;
+      while((hi > lo) && (Screen[base+hi] == Front[base+hi])) hi = hi - 1;
+    }
+    SendLo[bank] = (lo <= hi) ? lo : SCREENW;  // empty when SendLo > SendHi
+    SendHi[bank] = (lo <= hi) ? hi : 0;
+    DirtyLo[bank] = SCREENW;
+    DirtyHi[bank] = 0;
+  }
+  frame = Front;
+  Front = Screen;
+  Screen = frame;
+  for(bank=0; bank<BANKS; bank=bank+1){
+    base = SCREENW*bank;
+    for(x=SendLo[bank]; x<=SendHi[bank]; x=x+1){
+      Screen[base+x] = Front[base+x];   // the two agree everywhere again
+    }
+  }
+}
+
+//********Nokia5110_MarkDirty*****************
+// Record that columns x0..x1 of bank changed after writing
+// Screen directly (gfx.h).
+void Nokia5110_MarkDirty(uint32_t bank, uint32_t x0, uint32_t x1){
+  markDirty(bank, x0, x1);
+}
+
+//********Nokia5110_InvalidateBuffer*****************
+// Make the next swap (Nokia5110_DisplayBuffer or
+// Nokia5110_SwapBuffers) send the whole frame.
+void Nokia5110_InvalidateBuffer(void){
+  GlassStale = 1;
 }
-uint8_t Screen[SCREENW*SCREENH/8]; // buffer stores the next image to be printed on the screen
 
 //********Nokia5110_PrintBMP*****************
 // Bitmaps defined above were created for the LM3S1968 or
@@ -464,16 +598,16 @@ void Nokia5110_PrintBMP(uint8_t xpos, uint8_t ypos, const uint8_t *ptr, uint8_t
   for(i=1; i<=(width*height/2); i=i+1){
     // the left pixel is in the upper 4 bits
     if(((ptr[j]>>4)&0xF) > threshold){
-      Screen[screenx] |= mask;
+      setByte(screenx, Screen[screenx]|mask);
     } else{
-      Screen[screenx] &= ~mask;
+      setByte(screenx, Screen[screenx]&~mask);
     }
     screenx = screenx + 1;
     // the right pixel is in the lower 4 bits
     if((ptr[j]&0xF) > threshold){
-      Screen[screenx] |= mask;
+      setByte(screenx, Screen[screenx]|mask);
     } else{
-      Screen[screenx] &= ~mask;
+      setByte(screenx, Screen[screenx]&~mask);
     }
     screenx = screenx + 1;
     j = j + 1;
@@ -499,17 +633,160 @@ void Nokia5110_PrintBMP(uint8_t xpos, uint8_t ypos, const uint8_t *ptr, uint8_t
 // This routine clears this buffer
 void Nokia5110_ClearBuffer(void){int i;
   for(i=0; i<SCREENW*SCREENH/8; i=i+1){
-    Screen[i] = 0;              // clear buffer
+    setByte(i, 0);              // clear buffer
   }
 }
 
 //********Nokia5110_DisplayBuffer*****************
-// Fill the whole screen by drawing a 48x84 screen image.
+// Swap the buffers and send the columns of the new frame that
+// differ from the last one, blocking until they are out. Screen
+// keeps its contents.
 // inputs: none
 // outputs: none
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_DisplayBuffer(void){
-  Nokia5110_DrawFullImage(Screen);
+  uint32_t bank, x;
+  waitFlushIdle();                      // let asynchronous flushes (and a pending swap) finish first
+  swapBuffers();
+  for(bank=0; bank<BANKS; bank=bank+1){
+    if(SendLo[bank] > SendHi[bank]){
+      continue;                         // bank unchanged
+    }
+    lcdwrite(COMMAND, 0x80|SendLo[bank]); // setting bit 7 updates X-position
+    lcdwrite(COMMAND, 0x40|bank);       // setting bit 6 updates Y-position
+    for(x=SendLo[bank]; x<=SendHi[bank]; x=x+1){
+      lcddatawrite(Front[SCREENW*bank + x]);
+    }
+  }
+}
+
+// *************************** uDMA flush ***************************
+// Nokia5110_SwapBuffers sends the send spans of Front without the CPU.
+// SSI0 runs with EOT set, so its TX interrupt means "FIFO empty and shifter
+// idle", the only time D/C may change. Per span, SSI0_Handler steps through:
+//   COMMAND  D/C low, 0x80|x and 0x40|bank in the FIFO; wait for idle
+//   DATA     D/C high, uDMA channel 11 feeds the span; wait for its done flag
+//   DRAIN    wait for idle again, then take the next bank
+// A swap requested while a flush runs is pending until the last span has
+// drained; SSI0_Handler then swaps and starts the next flush itself, so the
+// panel only ever receives whole frames.
+static uint32_t FlushBank;
+static volatile uint8_t SwapPending;
+static void (*SwapDone)(void *arg);
+static void *SwapArg;
+static void (*FlushDone)(void *arg);
+static void *FlushArg;
+
+static void startFlush(void);
+
+// Start the next send span, or finish: run a pending swap, or report
+// that the last frame is out. Call with SSI0 idle and SSI0_Handler
+// unable to run.
+static void flushNext(void){
+  while(FlushBank < BANKS){
+    if(SendLo[FlushBank] <= SendHi[FlushBank]){
+      DC = DC_COMMAND;
+      SSI0_DR_R = 0x80|SendLo[FlushBank]; // setting bit 7 updates X-position
+      SSI0_DR_R = 0x40|FlushBank;       // setting bit 6 updates Y-position
+      FlushState = FLUSH_COMMAND;
+      SSI0_IM_R |= SSI_IM_TXIM;         // interrupt once both have shifted out
+      return;
+    }
+    FlushBank = FlushBank + 1;
+  }
+  FlushState = FLUSH_IDLE;
+  if(SwapPending){
+    startFlush();
+  } else if(FlushDone){
+    FlushDone(FlushArg);
+  }
+}
+
+// Swap, tell the caller Screen is free again, and send the new Front
+static void startFlush(void){
+  SwapPending = 0;
+  swapBuffers();
+  FlushBank = 0;
+  if(SwapDone){
+    SwapDone(SwapArg);
+  }
+  flushNext();
+}
+
+//********Nokia5110_SwapBuffers*****************
+// Hand the finished Screen to the display. With no flush running
+// the buffers swap now; otherwise the swap waits until the frame
+// being sent is complete and happens in SSI0_Handler. Either way
+// the columns that differ from the previous frame then stream out
+// by uDMA.
+// inputs: done  called (from SSI0_Handler, or before returning)
+//               once the swap has happened
+//         arg   passed to done
+// outputs: 1 if accepted, 0 if a swap is already pending
+int Nokia5110_SwapBuffers(void (*done)(void *arg), void *arg){
+  uint32_t state, idle;
+  if(SwapPending){
+    return 0;
+  }
+  SwapDone = done;
+  SwapArg = arg;
+  state = Atomic_Enter();               // the running flush may end right now
+  SwapPending = 1;
+  idle = (FlushState == FLUSH_IDLE);    // if not, flushNext swaps when it ends
+  Atomic_Exit(state);
+  if(idle){
+    while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){}; // D/C may only change while idle
+    startFlush();
+  }
+  return 1;
+}
+
+//********Nokia5110_OnFlushDone*****************
+// Register a function to call each time a flush ends with no swap
+// pending, i.e. once every frame handed over is on the panel.
+// inputs: done  called from SSI0_Handler, or from
+//               Nokia5110_SwapBuffers if nothing had to be sent
+//               (0 for none)
+//         arg   passed to done
+// outputs: none
+void Nokia5110_OnFlushDone(void (*done)(void *arg), void *arg){
+  uint32_t state = Atomic_Enter();
+  FlushDone = done;
+  FlushArg = arg;
+  Atomic_Exit(state);
+}
+
+//********Nokia5110_FlushBusy*****************
+// Nonzero while a flush is running or a swap is pending.
+int Nokia5110_FlushBusy(void){
+  return (FlushState != FLUSH_IDLE) || SwapPending;
+}
+
+// SSI0 interrupt: uDMA completion and end of transmission
+void SSI0_Handler(void){
+  if(FlushState == FLUSH_DATA){
+    if(Udma_TakeDone(UDMA_CH_SSI0TX)){
+      SSI0_DMACTL_R &= ~SSI_DMACTL_TXDMAE;
+      FlushState = FLUSH_DRAIN;
+      SSI0_IM_R |= SSI_IM_TXIM;         // wait for the last bytes to shift out
+    }
+    return;
+  }
+  if((SSI0_RIS_R&SSI_RIS_TXRIS) == 0){
+    return;
+  }
+  SSI0_IM_R &= ~SSI_IM_TXIM;            // level interrupt while idle: mask it
+  if(FlushState == FLUSH_COMMAND){
+    DC = DC_DATA;
+    FlushState = FLUSH_DATA;
+    SSI0_DMACTL_R |= SSI_DMACTL_TXDMAE;
+    Udma_StartToPeripheral(UDMA_CH_SSI0TX, &Front[SCREENW*FlushBank + SendLo[FlushBank]],
+                           &SSI0_DR_R, SendHi[FlushBank] - SendLo[FlushBank] + 1,
+                           UDMA_CHCTL_ARBSIZE_4);
+  } else if(FlushState == FLUSH_DRAIN){
+    FlushBank = FlushBank + 1;
+    flushNext();
+  }
 }
 
 const unsigned char Masks[8]={0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x80};
@@ -519,7 +796,8 @@ const unsigned char Masks[8]={0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x80};
 //        j  the column index  (0 to 83 in this case), x-coordinate
 // Output: none		
 void Nokia5110_ClrPxl(uint32_t i, uint32_t j){
-  Screen[84*(i>>3) + j] &= ~Masks[i&0x07];
+  uint32_t index = 84*(i>>3) + j;
+  setByte(index, Screen[index]&~Masks[i&0x07]);
 }
 //------------Nokia5110_SetPxl------------
 // Set the Image pixel at (i, j), turning it on.
@@ -527,6 +805,7 @@ void Nokia5110_ClrPxl(uint32_t i, uint32_t j){
 //        j  the column index  (0 to 83 in this case), x-coordinate
 // Output: none		
 void Nokia5110_SetPxl(uint32_t i, uint32_t j){
-  Screen[84*(i>>3) + j] |= Masks[i&0x07];
+  uint32_t index = 84*(i>>3) + j;
+  setByte(index, Screen[index]|Masks[i&0x07]);
 }
 
@@ -69,12 +69,12 @@
 // commands to the PCD8544 driver.  One new feature of the
 // LM4F120 is that its SSIs can get their baud clock from
 // either the system clock or from the 16 MHz precision
-// internal oscillator.  If the system clock is faster than
-// 50 MHz, the SSI baud clock will be faster than the 4 MHz
-// maximum of the Nokia 5110.
+// internal oscillator.  The SSI prescaler is computed from
+// SystemCoreClock so the baud clock stays at or below the
+// 4 MHz maximum of the Nokia 5110.
 // inputs: none
 // outputs: none
-// assumes: system clock rate of 50 MHz or less
+// assumes: Clock_Init has published SystemCoreClock
 void Nokia5110_Init(void);
 
 //********Nokia5110_OutChar*****************
@@ -159,13 +159,62 @@ void Nokia5110_PrintBMP(uint8_t xpos, uint8_t ypos, const uint8_t *ptr, uint8_t
 // This routine clears this buffer
 void Nokia5110_ClearBuffer(void);
 
+// The back buffer: six banks of 84 column bytes, bit 0 at the
+// top of each bank. Drawing code that writes it directly must
+// report what it changed with Nokia5110_MarkDirty. A second,
+// front buffer holds the frame on the glass; the two trade
+// places on every swap, so never keep a copy of this pointer.
+extern uint8_t *Screen;
+
+//********Nokia5110_MarkDirty*****************
+// Record that columns x0..x1 of bank changed after writing
+// Screen directly (gfx.h).
+void Nokia5110_MarkDirty(uint32_t bank, uint32_t x0, uint32_t x1);
+
+//********Nokia5110_InvalidateBuffer*****************
+// Make the next swap (Nokia5110_DisplayBuffer or
+// Nokia5110_SwapBuffers) send the whole frame.
+void Nokia5110_InvalidateBuffer(void);
+
 //********Nokia5110_DisplayBuffer*****************
-// Fill the whole screen by drawing a 48x84 screen image.
+// Swap the buffers and send the columns of the new frame that
+// differ from the last one, blocking until they are out. Screen
+// keeps its contents.
 // inputs: none
 // outputs: none
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_DisplayBuffer(void);
 
+//********Nokia5110_SwapBuffers*****************
+// Hand the finished Screen to the display and return. With no
+// flush running the buffers swap now; otherwise the swap waits
+// until the frame being sent is complete and happens in
+// SSI0_Handler. Either way the columns that differ from the
+// previous frame then stream out by uDMA (SSI0 TX, channel 11),
+// so the panel only ever shows whole frames. Do not draw into
+// Screen until done has been called; Screen then holds a copy
+// of the frame just handed over. Blocking LCD calls wait until
+// the flush has finished.
+// inputs: done  called (from SSI0_Handler, or before returning)
+//               once the swap has happened
+//         arg   passed to done
+// outputs: 1 if accepted, 0 if a swap is already pending
+int Nokia5110_SwapBuffers(void (*done)(void *arg), void *arg);
+
+//********Nokia5110_OnFlushDone*****************
+// Register a function to call each time a flush ends with no swap
+// pending, i.e. once every frame handed over is on the panel.
+// inputs: done  called from SSI0_Handler, or from
+//               Nokia5110_SwapBuffers if nothing had to be sent
+//               (0 for none)
+//         arg   passed to done
+// outputs: none
+void Nokia5110_OnFlushDone(void (*done)(void *arg), void *arg);
+
+//********Nokia5110_FlushBusy*****************
+// Nonzero while a flush is running or a swap is pending.
+int Nokia5110_FlushBusy(void);
+
 //------------Nokia5110_ClrPxl------------
 // Clear the Image pixel at (i, j), turning it dark.
 // Input: i  the row index  (0 to 47 in this case),    y-coordinate
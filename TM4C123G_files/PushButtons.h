@@ -7,18 +7,39 @@
 #include "lm35_control.h"
 #include "LedSpeaker.h"
 #include "Nokia5110.h"
-#include <stdio.h>
+#include "event_loop.h"
+#include "timebase.h"
+#include "wait.h"
+#include "isr_stats.h"
+#include "irq_priority.h"
+#include "spsc.h"
+#include "lcd_frame.h"
+#include "atomic.h"
+#include "log.h"
+#include "fmt.h"
+
+#include "soft_timer.h"
 
 extern void Timer5_Init(void);
-extern void Timer5_DelayMs(uint32_t ms);
 extern void Timer5_DelayUs(uint32_t us);
 
-// Declare TEMP_THRESHOLD as an external variable
-extern volatile float TEMP_THRESHOLD;
-extern volatile uint8_t isDeepSleepPressed;
+// Declare TEMP_THRESHOLD as an external variable (whole degrees C, atomic.h access)
+extern volatile uint32_t TEMP_THRESHOLD;
+
+// One button interrupt, published by GPIOE_Handler through buttonRing
+typedef struct {
+    uint32_t seq;          // Increments by one per interrupt; a gap means presses were dropped
+    uint32_t status;       // Masked interrupt status (E1-E4 bits)
+    uint64_t timestamp;    // Timebase us of the interrupt
+} ButtonRecord;
+
+SPSC_DEFINE(buttonRing, ButtonRecord, 8);
+static uint32_t buttonSeq = 0;
+
 // Function prototypes
 void PushButtons_Init(void);
 void GPIOE_Handler(void);  // ISR for push buttons
+void PushButtons_HandleEvent(const Event *evt);
 
 // Initialize Port E for push buttons (E1-E4) with interrupts
 void PushButtons_Init(void) {
@@ -37,40 +58,74 @@ void PushButtons_Init(void) {
 }
 
 // GPIO Port E Interrupt Service Routine (ISR)
+// Only publishes the press; the buttons are acted on in PushButtons_HandleEvent
 void GPIOE_Handler(void) {
+    ISR_STATS_ENTER(ISR_GPIOE);
+    IRQ_BENCH_LOAD();
     uint32_t status = GPIOE->MIS & 0x1E;  // Get masked interrupt status
-    if (status & 0x02) {  // E1: Increase TEMP_THRESHOLD
-        TEMP_THRESHOLD++;
-				//lcd print
-				char temp_thresh[50];
-				Nokia5110_Clear();
-				sprintf(temp_thresh, "Limit: %.0f", TEMP_THRESHOLD);
-				Nokia5110_OutString(temp_thresh);
-			
-        printString("TEMP_THRESHOLD increased to: ");
-        printFloat(TEMP_THRESHOLD, 1);
-        printString(" C\r\n");
+
+    ButtonRecord rec = { buttonSeq++, status, Timebase_NowUs() };
+    Spsc_Push(&buttonRing, &rec);
+    if (status & 0x10) {
+        Wait_Signal(WAIT_EVT_CANCEL);   // Abandon scan/alert/averaging within one step
     }
+    EventLoop_Post(EVT_BUTTON, 0);
+
+		GPIOE->ICR |= 0x1E;  // Clear the interrupt
+		ISR_STATS_EXIT(ISR_GPIOE);
+}
 
-    if (status & 0x04) {  // E2: Decrease TEMP_THRESHOLD
-        if (TEMP_THRESHOLD > 0) TEMP_THRESHOLD--;
-				//lcd print
-				char temp_thresh[50];
-				Nokia5110_Clear();
-				sprintf(temp_thresh, "Limit: %.0f", TEMP_THRESHOLD);
-				Nokia5110_OutString(temp_thresh);
-			
-        printString("TEMP_THRESHOLD decreased to: ");
-        printFloat(TEMP_THRESHOLD, 1);
-        printString(" C\r\n");
+// Show the new threshold on the LCD and UART
+static void PushButtons_ShowThreshold(uint8_t increased) {
+		//lcd print
+		char temp_thresh[50];
+		PROFILE_ENTER(PROF_FORMAT);
+		Fmt_Uint(Fmt_Str(temp_thresh, "Limit: "), TEMP_THRESHOLD, 0, ' ');
+		PROFILE_EXIT(PROF_FORMAT);
+		Lcd_ShowText(temp_thresh);
+
+    if (increased) {
+        LOG_I(BTN, "TEMP_THRESHOLD increased to: %u C", TEMP_THRESHOLD);
+    } else {
+        LOG_I(BTN, "TEMP_THRESHOLD decreased to: %u C", TEMP_THRESHOLD);
     }
+}
+
+// EVT_BUTTON: act on every press queued since the last event
+void PushButtons_HandleEvent(const Event *evt) {
+    static uint32_t expectedSeq = 0;
+    ButtonRecord rec;
+    (void)evt;
+
+    while (Spsc_Pop(&buttonRing, &rec)) {
+        if (rec.seq != expectedSeq) {
+            LOG_W(BTN, "Button presses dropped: %u", rec.seq - expectedSeq);
+        }
+        expectedSeq = rec.seq + 1;
 
-    if (status & 0x10) {  // E4: Enter deep sleep
-        TurnOffPowerLED();
-				//EnterDeepSleep();
-				isDeepSleepPressed = 1;
+        if (rec.status & 0x02) {  // E1: Increase TEMP_THRESHOLD
+            Atomic_Add(&TEMP_THRESHOLD, 1);
+            PushButtons_ShowThreshold(1);
+        }
+
+        if (rec.status & 0x04) {  // E2: Decrease TEMP_THRESHOLD
+            uint32_t limit;
+            do {                              // Decrement, but never below 0
+                limit = TEMP_THRESHOLD;
+                if (limit == 0) break;
+            } while (!Atomic_CompareExchange(&TEMP_THRESHOLD, limit, limit - 1));
+            PushButtons_ShowThreshold(0);
+        }
+
+        if (rec.status & 0x08) {  // E3: Dump profiling zones
+            EventLoop_Post(EVT_PROFILE_DUMP, 0);
+        }
+
+        if (rec.status & 0x10) {  // E4: Enter deep sleep
+            TurnOffPowerLED();
+            EventLoop_Post(EVT_SLEEP_REQUEST, 0);
+        }
     }
-		GPIOE->ICR |= 0x1E;  // Clear the interrupt
 }
 
 #endif  // PUSHBUTTONS_H
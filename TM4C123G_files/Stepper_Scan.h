@@ -5,21 +5,51 @@
 #include <stdint.h>
 #include "DistanceSensor.h"
 #include "Nokia5110.h"
-#include <stdio.h>
+#include "fmt.h"
 #include "printHelper.h"
 #include "plot.h"
+#include "event_loop.h"
+#include "lcd_frame.h"
+
+#include "soft_timer.h"
+#include "uart0.h"
+#include "scan_stream.h"
 
 extern void Timer5_Init(void);
-extern void Timer5_DelayMs(uint32_t ms);
 extern void Timer5_DelayUs(uint32_t us);
 
-extern volatile uint32_t distance;
-
 #define MAX_STEPS 180
 
-// Arrays to store distances and angles
-uint16_t distanceArray[MAX_STEPS];
+// Raw ScanBuffer export over UART0 by uDMA, opt-in (README, "Opt-in build
+// options"). Off by default: scan_stream.h already sends every bin, framed
+// and CRC-checked, while the raw struct is an unframed binary burst in the
+// middle of the console text that no host tool decodes.
+#ifndef SCAN_EXPORT_ENABLED
+#define SCAN_EXPORT_ENABLED 0
+#endif
+
+#define SCAN_MAGIC 0x314E4353      // "SCN1" in memory order
+
+// One scan's results. Exported over UART0 exactly as laid out here
+// (little-endian, no padding), so the struct is its own wire format.
+typedef struct {
+    uint32_t magic;                // SCAN_MAGIC
+    uint32_t scanId;               // Increments every scan
+    uint32_t count;                // Bins used (scanBins); the rest are unused
+    uint16_t distance[MAX_STEPS];  // cm, DISTANCE_NO_ECHO if nothing came back
+    uint32_t binTime[MAX_STEPS];   // Echo time of each bin, us after scanStartTime
+} ScanBuffer;
+
+// Ping-pong buffers: a scan fills one while the other may still be on its
+// way out of UART0. A buffer is busy from Uart0_Export() until its callback.
+static ScanBuffer scanBuffers[2];
+static volatile uint8_t scanBufferBusy[2];
+static ScanBuffer *scanBuf = &scanBuffers[0];   // Buffer of the scan in progress
+static uint32_t scanId;
+static uint32_t scanExportSkipped;              // Scans not exported (UART busy)
+
 int angleArray[MAX_STEPS];
+uint64_t scanStartTime;            // Timebase us when the scan started
 char buffer[50];
 
 void RGB_Init(void);
@@ -38,92 +68,342 @@ void Stepper_Init(void) {
 // Full-step sequence for stepper motor (PD0-PD3 control IN1, IN2, IN3, IN4)
 const uint8_t stepSequence[4] = {0x01, 0x02, 0x04, 0x08}; // Step sequence for motor control
 
-// Function to scan from -90 to 90 degrees once
-void StepperMotor_Scan(void) {
-    int stepsPerDegree = 4096 / 360;  // Steps per degree for a full 360-degree rotation
-    int totalSteps = ((180 * stepsPerDegree) * 8 / 14);  // Total steps for 180 degrees (-90 to 90)
-    int currentStep = 0;
+#define SCAN_SETTLE_MS 2     // Motor settle time after each step
+#define SCAN_HOLD_MS   5000  // How long the plot stays on the LCD
 
-    // Reset object detection variables
-    uint16_t initialDistance = 0xFFFF;  // Initial value to filter
-    int objectStartAngle = -1;
-    int objectEndAngle = -1;
-    uint16_t objectDistance = 0xFFFF;  // Reset to large value
-    int objectDetected = 0;
+// Scan state machine; advanced by EVT_SCAN_* events in the scan task. The
+// motion and ranging steps run there, above the app task, so LCD drawing and
+// console output in the app task never delay a step. Drawing stays in the
+// app task: the scan task posts EVT_SCAN_PLOT and EVT_SCAN_DONE to it.
+typedef enum {
+    SCAN_IDLE,
+    SCAN_STARTING,    // StepperMotor_Scan() sent EVT_SCAN_START
+    SCAN_SETTLING,    // Waiting for the motor after a step
+    SCAN_RANGING,     // Ranging task is measuring
+    SCAN_HOLDING,     // Plot on screen
+    SCAN_SHOWING      // EVT_SCAN_DONE posted, result not yet on the LCD
+} ScanState;
 
-    // Clear previous data
-    for (int i = 0; i < MAX_STEPS; i++) {
-        distanceArray[i] = 0xFFFF;  // Initialize with a large value
-        angleArray[i] = -90 + (i * 180 / MAX_STEPS);  // Map angles from -90 to 90
-    }
+#define SCAN_QUEUE_SIZE 8
 
-    // Perform the scan
-    for (int step = 0; step < totalSteps; step++) {
-        // Rotate motor one step
-        uint8_t currentStepValue = stepSequence[currentStep % 4];
-        GPIOD->DATA = (GPIOD->DATA & 0xF0) | currentStepValue;
-        currentStep++;
-        Timer5_DelayUs(2000); // Adjust delay for smooth operation
+static SoftTimer scanTimer;
+static volatile ScanState scanState = SCAN_IDLE;
+static float scanTemperature;     // Reported in the stream of the next scan
+KERNEL_QUEUE_DEFINE(scanQueue, Event, SCAN_QUEUE_SIZE);   // Events for the scan task
+static Semaphore scanStopped = KERNEL_SEM_INIT(0, 1);     // Posted once EVT_SCAN_STOP ran
+static int scanStep;
+static int scanTotalSteps;
+static int scanMotorStep;
+static int scanLastBin;           // Bin of the previous step, -1 before the first
 
-        // Trigger distance measurement
-        TriggerPulse();
-        Timer5_DelayMs(15);  // Allow time for echo response
+// Scan settings (console "range" and "res"); apply from the next scan
+static int scanFromDeg = -90;     // Angle the motor is assumed to start at
+static int scanToDeg = 90;
+static int scanBins = MAX_STEPS;  // Distance bins across the range
 
-        // Store distance at corresponding angle
-        int index = step * MAX_STEPS / totalSteps;  // Map step to array index
-        if (index < MAX_STEPS) {
-            distanceArray[index] = distance;
-        }
+// Object detection state for the scan in progress
+static uint16_t initialDistance;
+static int objectStartAngle;
+static int objectEndAngle;
+static uint16_t objectDistance;
+static int objectDetected;
 
-        // Initialize initialDistance during the first few steps
-        if (step < 10) {
-            initialDistance = distance;
-            continue;
-        }
+void StepperMotor_Scan(float temperature);
+void StepperMotor_StopScan(void);
+uint8_t StepperMotor_Busy(void);
+uint8_t StepperMotor_SetRange(int fromDeg, int toDeg);
+uint8_t StepperMotor_SetResolution(int bins);
+void StepperMotor_HandleEvent(const Event *evt);
+void StepperMotor_HandleDisplayEvent(const Event *evt);
+void StepperMotor_ShowResult(void);
+void StepperMotor_Task(void *arg);
 
-        // Detect start of object
-        if (!objectDetected && distance < (initialDistance - 50)) {  // Threshold for detecting an object
-            objectStartAngle = angleArray[index];
-            objectDistance = distance;
-            objectDetected = 1;  // Object detection starts
-        }
+// Rotate one step and wait for the motor to settle
+static void Scan_Advance(void) {
+    uint8_t currentStepValue = stepSequence[scanMotorStep % 4];
+    GPIOD->DATA = (GPIOD->DATA & 0xF0) | currentStepValue;
+    scanMotorStep++;
+
+    scanState = SCAN_SETTLING;
+    SoftTimer_StartMs(&scanTimer, SCAN_SETTLE_MS, 0, EventLoop_PostFromTimer, EVENT_ARG(EVT_SCAN_SETTLED));
+}
+
+// Stream one finished bin
+static void Scan_StreamBin(int bin) {
+    ScanStream_Bin(scanBuf->scanId, bin, angleArray[bin], scanBuf->distance[bin], scanBuf->binTime[bin]);
+}
+
+// Store the echo for the current step and run object detection on it
+static void Scan_Record(void) {
+    int step = scanStep;
+    EchoRecord echo;
+    uint16_t binDistance;
+    uint64_t echoTime;
+    uint64_t trigger = DistanceSensor_TriggerTime();
+
+    // Only an echo that completed after this step's trigger belongs to this bin
+    if (DistanceSensor_TakeEcho(trigger, &echo)) {
+        binDistance = (echo.distance < DISTANCE_NO_ECHO) ? echo.distance : DISTANCE_NO_ECHO;
+        echoTime = echo.timestamp;
+    } else {
+        binDistance = DISTANCE_NO_ECHO;   // Plotted as "no object"
+        echoTime = trigger;
+    }
 
-        // Detect end of object (continue scanning even after detecting an object)
-        if (objectDetected && distance > (initialDistance - 30)) {  // Threshold for losing object
-            objectEndAngle = angleArray[index];
+    // Store distance at corresponding angle
+    int index = step * scanBins / scanTotalSteps;  // Map step to array index
+    if (index < scanBins) {
+        if (scanLastBin >= 0 && index != scanLastBin) {
+            Scan_StreamBin(scanLastBin);   // Moved on: the previous bin is final
         }
+        scanLastBin = index;
+        scanBuf->distance[index] = binDistance;
+        scanBuf->binTime[index] = (uint32_t)(echoTime - scanStartTime);
+    }
+
+    // A step without an echo says nothing about the scene
+    if (binDistance == DISTANCE_NO_ECHO) return;
+
+    // Initialize initialDistance from the last echo of the first few steps,
+    // or from the first echo at all if none of them returned one
+    if (step < 10 || initialDistance == DISTANCE_NO_ECHO) {
+        initialDistance = binDistance;
+        return;
     }
 
-    // Plot the data
-    dynamicPlot(distanceArray, angleArray, MAX_STEPS);
-    Timer5_DelayMs(5000);
+    // Detect start of object
+    if (!objectDetected && binDistance < (initialDistance - 50)) {  // Threshold for detecting an object
+        objectStartAngle = angleArray[index];
+        objectDistance = binDistance;
+        objectDetected = 1;  // Object detection starts
+    }
+
+    // Detect end of object (continue scanning even after detecting an object)
+    if (objectDetected && binDistance > (initialDistance - 30)) {  // Threshold for losing object
+        objectEndAngle = angleArray[index];
+    }
+}
+
+#if SCAN_EXPORT_ENABLED
+// Export complete: the buffer may be reused (UART0_Handler context)
+static void Scan_ExportDone(void *arg) {
+    scanBufferBusy[(ScanBuffer *)arg - scanBuffers] = 0;
+}
+#endif
 
-    // If an object was detected, calculate its average angle
-    int averageAngle = (objectDetected) ? (objectStartAngle + objectEndAngle) / 2 : -1;
+// Send the finished scan; the next scan carries on in the other buffer
+static void Scan_Export(void) {
+#if SCAN_EXPORT_ENABLED
+    uint8_t i = scanBuf - scanBuffers;
+
+    scanBufferBusy[i] = 1;
+    if (!Uart0_Export(scanBuf, sizeof(ScanBuffer), Scan_ExportDone, scanBuf)) {
+        scanBufferBusy[i] = 0;         // Previous export still running: drop this one
+        scanExportSkipped++;
+    }
+#endif
+}
+
+// buffer = "Avg Angle: <angle>\nDist: <distance> cm"
+static void Scan_FormatObject(int angle, uint16_t distance) {
+    char *p = Fmt_Str(buffer, "Avg Angle: ");
+    p = Fmt_Int(p, angle, 0, ' ');
+    p = Fmt_Str(p, "\nDist: ");
+    p = Fmt_Uint(p, distance, 0, ' ');
+    Fmt_Str(p, " cm");
+}
+
+// Average angle of the detected object, -1 if there is none
+static int Scan_AverageAngle(void) {
+    return (objectDetected) ? (objectStartAngle + objectEndAngle) / 2 : -1;
+}
+
+// Show the detection result text and control LEDs (app task, on
+// EVT_SCAN_DONE). Ends the scan: StepperMotor_Busy() reads 0 afterwards.
+void StepperMotor_ShowResult(void) {
+    int averageAngle = Scan_AverageAngle();
 
     // Display results and control LEDs
+    PROFILE_ENTER(PROF_FORMAT);
     if (objectDetected) {
         if (objectDistance >= 75 && objectDistance < 100) {
             Set_RGB_Color(0, 1, 0); // Green LED ON
-            sprintf(buffer, "Avg Angle: %d\nDist: %u cm", averageAngle, objectDistance);
+            Scan_FormatObject(averageAngle, objectDistance);
         } else if (objectDistance >= 50 && objectDistance < 75) {
             Set_RGB_Color(0, 0, 1); // Blue LED ON
-            sprintf(buffer, "Avg Angle: %d\nDist: %u cm", averageAngle, objectDistance);
+            Scan_FormatObject(averageAngle, objectDistance);
         } else if (objectDistance < 50) {
             Set_RGB_Color(1, 0, 0); // Red LED ON
-            sprintf(buffer, "Avg Angle: %d\nDist: %u cm", averageAngle, objectDistance);
+            Scan_FormatObject(averageAngle, objectDistance);
         }	else {
 						Set_RGB_Color(0, 0, 0); // Turn off all LEDs
-            sprintf(buffer, "NO OBJECT");
+            Fmt_Str(buffer, "NO OBJECT");
 				}
     } else {
         Set_RGB_Color(0, 0, 0); // Turn off all LEDs
-        sprintf(buffer, "NO OBJECT");
+        Fmt_Str(buffer, "NO OBJECT");
     }
+    PROFILE_EXIT(PROF_FORMAT);
 
     // Display on LCD
-    Nokia5110_Clear();
-    Nokia5110_OutString(buffer);
+    Lcd_ShowText(buffer);
+    scanState = SCAN_IDLE;
+}
+
+// Start one scan over the configured range (-90 to 90 degrees by default).
+// Returns immediately; the scan runs in the scan task and posts
+// EVT_SCAN_DONE when it has finished. temperature is only reported in the
+// stream. Called from the app task.
+void StepperMotor_Scan(float temperature) {
+    Event evt = { EVT_SCAN_START, 0 };
+
+    scanTemperature = temperature;
+    scanState = SCAN_STARTING;         // Busy from now on: settings stay put
+    Kernel_QueueSend(&scanQueue, &evt, KERNEL_WAIT_FOREVER);
+}
+
+// EVT_SCAN_START: set up the scan and take the first step
+static void Scan_Start(void) {
+    int stepsPerDegree = 4096 / 360;  // Steps per degree for a full 360-degree rotation
+    int span = scanToDeg - scanFromDeg;
+    scanTotalSteps = ((span * stepsPerDegree) * 8 / 14);  // Total steps for the range
+    scanMotorStep = 0;
+    scanStep = 0;
+    scanLastBin = -1;
+    scanStartTime = Timebase_NowUs();
+
+    // Only one export runs at a time, so at least one buffer is free
+    scanBuf = scanBufferBusy[0] ? &scanBuffers[1] : &scanBuffers[0];
+    scanBuf->magic = SCAN_MAGIC;
+    scanBuf->scanId = scanId++;
+    scanBuf->count = scanBins;
+
+    // Reset object detection variables
+    initialDistance = DISTANCE_NO_ECHO;  // No baseline yet
+    objectStartAngle = -1;
+    objectEndAngle = -1;
+    objectDistance = 0xFFFF;  // Reset to large value
+    objectDetected = 0;
+
+    // Clear previous data
+    for (int i = 0; i < MAX_STEPS; i++) {
+        scanBuf->distance[i] = 0xFFFF;  // Initialize with a large value
+        scanBuf->binTime[i] = 0;
+        angleArray[i] = scanFromDeg + (i * span / scanBins);  // Map bins onto the range
+    }
+
+    ScanStream_Begin(scanBuf->scanId, (uint32_t)scanStartTime, scanTemperature,
+                     scanFromDeg, scanToDeg, scanBins);
+    Scan_Advance();
+}
+
+// Stop the motor where it is (scan task)
+static void Scan_Stop(void) {
+    SoftTimer_Stop(&scanTimer);
+    scanState = SCAN_IDLE;
+}
+
+// Abort a scan in progress. Called from the app task; returns once the
+// scan task has stopped, so no step follows.
+void StepperMotor_StopScan(void) {
+    Event evt = { EVT_SCAN_STOP, 0 };
+
+    Kernel_SemReset(&scanStopped);
+    Kernel_QueueSend(&scanQueue, &evt, KERNEL_WAIT_FOREVER);
+    Kernel_SemWait(&scanStopped, KERNEL_WAIT_FOREVER);
+}
+
+// Nonzero from StepperMotor_Scan() until the result is shown
+uint8_t StepperMotor_Busy(void) {
+    return scanState != SCAN_IDLE;
+}
+
+// Scan from fromDeg to toDeg (-90 <= fromDeg < toDeg <= 90). Returns 0 if
+// the range is invalid or a scan is running.
+uint8_t StepperMotor_SetRange(int fromDeg, int toDeg) {
+    if (StepperMotor_Busy() || fromDeg < -90 || toDeg > 90 || fromDeg >= toDeg) return 0;
+    scanFromDeg = fromDeg;
+    scanToDeg = toDeg;
+    return 1;
+}
+
+// Number of distance bins (1..MAX_STEPS). Returns 0 if invalid or scanning.
+uint8_t StepperMotor_SetResolution(int bins) {
+    if (StepperMotor_Busy() || bins < 1 || bins > MAX_STEPS) return 0;
+    scanBins = bins;
+    return 1;
+}
+
+// Scan task event handler (EVT_SCAN_START, EVT_SCAN_STOP, EVT_SCAN_SETTLED,
+// EVT_SCAN_SAMPLE, EVT_SCAN_HOLD_DONE)
+void StepperMotor_HandleEvent(const Event *evt) {
+    if (evt->type == EVT_SCAN_STOP) {
+        Scan_Stop();
+        Kernel_SemPost(&scanStopped);
+        return;
+    }
+    if (scanState != SCAN_IDLE && Wait_Pending(WAIT_EVT_CANCEL)) {
+        Scan_Stop();               // Cancelled: stop before the next step
+        return;
+    }
+
+    switch (evt->type) {
+    case EVT_SCAN_START:
+        if (scanState != SCAN_STARTING) break;
+        Scan_Start();
+        break;
+
+    case EVT_SCAN_SETTLED:
+        if (scanState != SCAN_SETTLING) break;
+        // Trigger distance measurement
+        scanState = SCAN_RANGING;
+        DistanceSensor_RequestRange(EVT_SCAN_SAMPLE);
+        break;
+
+    case EVT_SCAN_SAMPLE:
+        if (scanState != SCAN_RANGING) break;
+        Scan_Record();
+        if (++scanStep < scanTotalSteps) {
+            Scan_Advance();
+        } else {
+            if (scanLastBin >= 0) {
+                Scan_StreamBin(scanLastBin);
+            }
+            ScanStream_End(scanBuf->scanId, scanBins, objectDetected, Scan_AverageAngle(), objectDistance);
+
+            // Plot the data
+            Scan_Export();
+            EventLoop_Post(EVT_SCAN_PLOT, 0);
+            scanState = SCAN_HOLDING;
+            SoftTimer_StartMs(&scanTimer, SCAN_HOLD_MS, 0, EventLoop_PostFromTimer, EVENT_ARG(EVT_SCAN_HOLD_DONE));
+        }
+        break;
+
+    case EVT_SCAN_HOLD_DONE:
+        if (scanState != SCAN_HOLDING) break;
+        scanState = SCAN_SHOWING;
+        if (!EventLoop_Post(EVT_SCAN_DONE, 0)) {
+            scanState = SCAN_IDLE;     // Nobody will show it
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+// App task event handler (EVT_SCAN_PLOT): the scan buffer is left alone
+// while the scan holds, so the plot is drawn from it here
+void StepperMotor_HandleDisplayEvent(const Event *evt) {
+    if (evt->type == EVT_SCAN_PLOT && scanState == SCAN_HOLDING) {
+        dynamicPlot(scanBuf->distance, angleArray, scanBins);
+    }
+}
+
+// Scan task: motion and ranging steps, below ranging and above the app task
+void StepperMotor_Task(void *arg) {
+    (void)arg;
+    EventLoop_RunQueue(&scanQueue);
 }
 
 
@@ -0,0 +1,217 @@
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+#include "TM4C123.h"
+#include <stdint.h>
+#include "main_api.h"
+
+// UART output from printHelper.h, for Atomic_Bench
+void printString(const char *str);
+void printInt(uint32_t num);
+
+// ==================== Atomics and Critical Sections ====================
+// Primitives for state shared between ISRs and tasks:
+//   Atomic_Enter/Exit    - critical section that raises BASEPRI instead of
+//                          setting PRIMASK, so IRQs more urgent than
+//                          ATOMIC_SYSCALL_PRIORITY are never delayed
+//   Atomic_Add/Or/And    - LDREX/STREX read-modify-write, no masking at all
+//   Atomic_CompareExchange
+//   SeqLock              - one writer publishes a multi-word snapshot; readers
+//                          retry instead of blocking the writer. A reader
+//                          waits out a write in progress, so it must never
+//                          preempt its writer: an ISR reads only data
+//                          written by a more urgent ISR, a task only data
+//                          written by an ISR or a task of equal or higher
+//                          priority
+//
+// IRQs at a priority below ATOMIC_SYSCALL_PRIORITY (only the echo capture,
+// see irq_priority.h) run even inside critical sections, so they may use the
+// lock-free primitives here and nothing that takes a critical section (kernel,
+// event loop, soft timers).
+//
+// WFI check-then-sleep sequences keep using PRIMASK: an interrupt masked by
+// BASEPRI does not end WFI.
+
+#define ATOMIC_SYSCALL_PRIORITY 1   // Critical sections mask this NVIC priority and below
+#define ATOMIC_BASEPRI          (ATOMIC_SYSCALL_PRIORITY << (8 - __NVIC_PRIO_BITS))
+
+typedef struct {
+    volatile uint32_t seq;   // Odd while a write is in progress
+} SeqLock;
+
+// Function prototypes
+uint32_t Atomic_Enter(void);
+void Atomic_Exit(uint32_t state);
+uint32_t Atomic_Add(volatile uint32_t *p, int32_t delta);
+uint32_t Atomic_Or(volatile uint32_t *p, uint32_t bits);
+uint32_t Atomic_And(volatile uint32_t *p, uint32_t bits);
+uint8_t Atomic_CompareExchange(volatile uint32_t *p, uint32_t expected, uint32_t desired);
+void SeqLock_WriteBegin(SeqLock *lock);
+void SeqLock_WriteEnd(SeqLock *lock);
+uint32_t SeqLock_ReadBegin(const SeqLock *lock);
+uint8_t SeqLock_ReadRetry(const SeqLock *lock, uint32_t start);
+
+// Enter a critical section; returns the state for Atomic_Exit. Nests.
+uint32_t Atomic_Enter(void) {
+    uint32_t state = __get_BASEPRI();
+    __set_BASEPRI_MAX(ATOMIC_BASEPRI);   // Only ever raises the mask
+    __ISB();
+    return state;
+}
+
+// Leave a critical section
+void Atomic_Exit(uint32_t state) {
+    __set_BASEPRI(state);
+}
+
+// *p += delta; returns the new value
+uint32_t Atomic_Add(volatile uint32_t *p, int32_t delta) {
+    uint32_t value;
+    do {
+        value = __LDREXW(p) + (uint32_t)delta;
+    } while (__STREXW(value, p));
+    return value;
+}
+
+// *p |= bits; returns the new value
+uint32_t Atomic_Or(volatile uint32_t *p, uint32_t bits) {
+    uint32_t value;
+    do {
+        value = __LDREXW(p) | bits;
+    } while (__STREXW(value, p));
+    return value;
+}
+
+// *p &= bits; returns the new value
+uint32_t Atomic_And(volatile uint32_t *p, uint32_t bits) {
+    uint32_t value;
+    do {
+        value = __LDREXW(p) & bits;
+    } while (__STREXW(value, p));
+    return value;
+}
+
+// If *p == expected, store desired and return 1; otherwise return 0
+uint8_t Atomic_CompareExchange(volatile uint32_t *p, uint32_t expected, uint32_t desired) {
+    do {
+        if (__LDREXW(p) != expected) {
+            __CLREX();
+            return 0;
+        }
+    } while (__STREXW(desired, p));
+    return 1;
+}
+
+// Writer: start updating the protected data (single writer only)
+void SeqLock_WriteBegin(SeqLock *lock) {
+    lock->seq++;
+    __DMB();                 // Odd count visible before the data changes
+}
+
+// Writer: the protected data is consistent again
+void SeqLock_WriteEnd(SeqLock *lock) {
+    __DMB();                 // Data visible before the even count
+    lock->seq++;
+}
+
+// Reader: wait out a write in progress and return the start count. Spins
+// forever if the reader preempted the writer (see the rule above).
+uint32_t SeqLock_ReadBegin(const SeqLock *lock) {
+    uint32_t seq;
+    while ((seq = lock->seq) & 1);
+    __DMB();
+    return seq;
+}
+
+// Reader: nonzero if the data changed while it was being copied
+uint8_t SeqLock_ReadRetry(const SeqLock *lock, uint32_t start) {
+    __DMB();
+    return lock->seq != start;
+}
+
+// ==================== Primitive Cost Benchmark ====================
+// With ATOMIC_BENCH_ENABLED each primitive is run ATOMIC_BENCH_LOOPS times
+// uncontended and its average cost in cycles, less the loop overhead, is
+// printed over UART0.
+
+#ifndef ATOMIC_BENCH_ENABLED
+#define ATOMIC_BENCH_ENABLED 0
+#endif
+
+#if ATOMIC_BENCH_ENABLED
+
+#define ATOMIC_BENCH_LOOPS 256
+
+void Atomic_Bench(void);
+
+static void Atomic_BenchPrint(const char *name, uint32_t cycles, uint32_t overhead) {
+    printString(name);
+    printString(": ");
+    printInt(cycles > overhead ? (cycles - overhead) / ATOMIC_BENCH_LOOPS : 0);
+    printString(" cycles\r\n");
+}
+
+// Measure every primitive once at startup
+void Atomic_Bench(void) {
+    static volatile uint32_t word;
+    static SeqLock lock;
+    uint32_t start, overhead, state, seq;
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < ATOMIC_BENCH_LOOPS; i++) {
+        __NOP();
+    }
+    overhead = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < ATOMIC_BENCH_LOOPS; i++) {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        __set_PRIMASK(primask);
+    }
+    Atomic_BenchPrint("PRIMASK section", DWT->CYCCNT - start, overhead);
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < ATOMIC_BENCH_LOOPS; i++) {
+        state = Atomic_Enter();
+        Atomic_Exit(state);
+    }
+    Atomic_BenchPrint("BASEPRI section", DWT->CYCCNT - start, overhead);
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < ATOMIC_BENCH_LOOPS; i++) {
+        Atomic_Add(&word, 1);
+    }
+    Atomic_BenchPrint("Atomic_Add", DWT->CYCCNT - start, overhead);
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < ATOMIC_BENCH_LOOPS; i++) {
+        Atomic_CompareExchange(&word, word, word + 1);
+    }
+    Atomic_BenchPrint("Atomic_CompareExchange", DWT->CYCCNT - start, overhead);
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < ATOMIC_BENCH_LOOPS; i++) {
+        SeqLock_WriteBegin(&lock);
+        word = i;
+        SeqLock_WriteEnd(&lock);
+    }
+    Atomic_BenchPrint("SeqLock write", DWT->CYCCNT - start, overhead);
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < ATOMIC_BENCH_LOOPS; i++) {
+        do {
+            seq = SeqLock_ReadBegin(&lock);
+            (void)word;
+        } while (SeqLock_ReadRetry(&lock, seq));
+    }
+    Atomic_BenchPrint("SeqLock read", DWT->CYCCNT - start, overhead);
+}
+
+#else
+
+#define Atomic_Bench() ((void)0)
+
+#endif // ATOMIC_BENCH_ENABLED
+
+#endif // ATOMIC_H
@@ -0,0 +1,119 @@
+#ifndef BLOG_H
+#define BLOG_H
+
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include "uart0.h"
+#include "timebase.h"
+
+// ==================== Binary Log ====================
+// BLOG(fmt, ...) logs a printf-style line without formatting it on the
+// target. Each call site gets a numeric id from __COUNTER__; the format
+// string goes into the non-allocated ELF section .blog_fmt (never flashed)
+// as { uint32 id; char fmt[]; }, and the target only sends
+//
+//   0x1E | id (u16) | argBytes (u8) | timestamp us (u32) | args
+//
+// all little-endian, with every argument widened to one 32-bit word (ints
+// as their bit pattern, float/double as a float). host/blog_decode.cpp
+// reads .blog_fmt from termproject.axf and turns the UART capture back into
+// text; bytes outside frames pass through, so ordinary prints still work.
+//
+// Rules for call sites:
+//   - at most BLOG_MAX_ARGS arguments, numeric only (%d %u %x %c %f %e %g)
+//   - fmt is a plain string literal without quotes, backslashes or a
+//     trailing newline (the decoder ends every record with one)
+//   - call from the app task only, like every other UART print
+//   - ids are per translation unit, so use BLOG only from main.c's headers
+//
+// Building with BLOG_ENABLED 0 formats the same lines on the target instead.
+
+#ifndef BLOG_ENABLED
+#define BLOG_ENABLED 1
+#endif
+
+#define BLOG_SYNC     0x1E   // ASCII record separator, never in our text
+#define BLOG_MAX_ARGS 4
+
+// Argument counting and mapping (0..BLOG_MAX_ARGS arguments)
+#define BLOG_CAT_(a, b) a##b
+#define BLOG_CAT(a, b) BLOG_CAT_(a, b)
+#define BLOG_STR_(x) #x
+#define BLOG_STR(x) BLOG_STR_(x)
+#define BLOG_NARGS_(_0, _1, _2, _3, _4, n, ...) n
+#define BLOG_NARGS(...) BLOG_NARGS_(0, ##__VA_ARGS__, 4, 3, 2, 1, 0)
+#define BLOG_MAP_0(f)
+#define BLOG_MAP_1(f, a) f(a)
+#define BLOG_MAP_2(f, a, b) f(a), f(b)
+#define BLOG_MAP_3(f, a, b, c) f(a), f(b), f(c)
+#define BLOG_MAP_4(f, a, b, c, d) f(a), f(b), f(c), f(d)
+#define BLOG_MAP(f, ...) BLOG_CAT(BLOG_MAP_, BLOG_NARGS(__VA_ARGS__))(f, ##__VA_ARGS__)
+
+#if BLOG_ENABLED
+
+// One argument as the 32-bit word that goes on the wire
+#define BLOG_WORD(x) _Generic((x), \
+    float: Blog_FloatBits, \
+    double: Blog_DoubleBits, \
+    default: Blog_IntBits)(x)
+
+#define BLOG(fmt, ...) BLOG_SITE(__COUNTER__, fmt, ##__VA_ARGS__)
+#define BLOG_SITE(id, fmt, ...) do { \
+    __asm volatile(".pushsection .blog_fmt,\"\",%progbits\n" \
+                   ".4byte " BLOG_STR(id) "\n" \
+                   ".asciz \"" fmt "\"\n" \
+                   ".popsection"); \
+    uint32_t blogArgs_[] = { 0, BLOG_MAP(BLOG_WORD, ##__VA_ARGS__) }; \
+    Blog_Write(id, &blogArgs_[1], sizeof(blogArgs_) - sizeof(uint32_t)); \
+} while (0)
+
+// Function prototypes
+uint32_t Blog_IntBits(uint32_t x);
+uint32_t Blog_FloatBits(float x);
+uint32_t Blog_DoubleBits(double x);
+void Blog_Write(uint16_t id, const uint32_t *args, uint32_t bytes);
+
+uint32_t Blog_IntBits(uint32_t x) {
+    return x;
+}
+
+uint32_t Blog_FloatBits(float x) {
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+uint32_t Blog_DoubleBits(double x) {
+    return Blog_FloatBits((float)x);
+}
+
+// Queue one frame on UART0
+void Blog_Write(uint16_t id, const uint32_t *args, uint32_t bytes) {
+    uint32_t now = (uint32_t)Timebase_NowUs();
+    const uint8_t *p = (const uint8_t *)args;
+
+    OutChar(BLOG_SYNC);
+    OutChar(id & 0xFF);
+    OutChar(id >> 8);
+    OutChar(bytes);
+    for (int i = 0; i < 4; i++) {
+        OutChar(now >> (8 * i));
+    }
+    for (uint32_t i = 0; i < bytes; i++) {
+        OutChar(p[i]);                          // Cortex-M is little-endian
+    }
+}
+
+#else
+
+// Format on the target: same output as the decoder, without the timestamp
+#define BLOG(fmt, ...) do { \
+    char blogLine_[80]; \
+    snprintf(blogLine_, sizeof(blogLine_), fmt "\r\n", ##__VA_ARGS__); \
+    printString(blogLine_); \
+} while (0)
+
+#endif // BLOG_ENABLED
+
+#endif // BLOG_H
@@ -3,7 +3,10 @@
 
 #include "tm4c123gh6pm.h"
 #include <stdint.h>
+#include "clock.h"
 #include "printHelper.h"
+#include "timebase.h"
+#include "isr_stats.h"
 
 // BMP280 I2C Address
 #define BMP280_I2C_ADDRESS 0x76
@@ -24,6 +27,8 @@ static float temperatureBuffer[FILTER_SIZE];
 static uint8_t bufferIndex = 0;
 static uint8_t readingsCount = 0;
 
+static volatile uint64_t bmp280Timestamp = 0;  // Timebase us of the last temperature read
+
 // Calibration parameters
 static uint16_t dig_T1;
 static int16_t dig_T2, dig_T3;
@@ -49,7 +54,7 @@ void I2C0_Init(void) {
     GPIO_PORTB_PCTL_R = (GPIO_PORTB_PCTL_R & 0xFFFF00FF) | 0x00003300; // Configure PB2 and PB3 as I2C
 
     I2C0_MCR_R = 0x10;           // Enable I2C Master mode
-    I2C0_MTPR_R = 24;            // Configure for 100 Kbps (assuming 16 MHz clock)
+    I2C0_MTPR_R = SystemCoreClock / (20 * 100000) - 1; // 100 Kbps: TPR = SysClk / (2 * (6 + 4) * SCL) - 1
 
     NVIC_EN0_R |= (1 << 8);      // Enable I2C0 interrupt
 }
@@ -75,9 +80,11 @@ float BMP280_ReadTemperature(void) {
     uint8_t msb, lsb, xlsb;
     int32_t rawTemp;
 
+    PROFILE_ENTER(PROF_BMP280_READ);
     msb = I2C_ReadRegister(BMP280_I2C_ADDRESS, TEMP_MSB);
     lsb = I2C_ReadRegister(BMP280_I2C_ADDRESS, TEMP_LSB);
     xlsb = I2C_ReadRegister(BMP280_I2C_ADDRESS, TEMP_XLSB);
+    bmp280Timestamp = Timebase_NowUs();
 
     rawTemp = ((msb << 12) | (lsb << 4) | (xlsb >> 4));
 
@@ -87,7 +94,8 @@ float BMP280_ReadTemperature(void) {
     var2 = (((((rawTemp >> 4) - ((int32_t)dig_T1)) * ((rawTemp >> 4) - ((int32_t)dig_T1))) >> 12) * ((int32_t)dig_T3)) >> 14;
     int32_t t_fine = var1 + var2;
     float temp = (t_fine * 5 + 128) >> 8;
-    return temp / 100.0; // Temperature in Celsius
+    PROFILE_EXIT(PROF_BMP280_READ);
+    return temp / 100.0f; // Temperature in Celsius (float literal: no double library call)
 }
 
 // Update Filtered Temperature using Interrupt
@@ -137,8 +145,10 @@ uint8_t I2C_ReadRegister(uint8_t deviceAddr, uint8_t regAddr) {
 
 // I2C Interrupt Handler
 void I2C0_Handler(void) {
+    ISR_STATS_ENTER(ISR_I2C0);
     BMP280_FilteredTemperature();
     I2C0_MICR_R = 0x01; // Clear the interrupt
+    ISR_STATS_EXIT(ISR_I2C0);
 }
 
 #endif // BMP280_H
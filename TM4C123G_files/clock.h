@@ -0,0 +1,77 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include "tm4c123gh6pm.h"
+#include "TM4C123.h"
+#include <stdint.h>
+
+// ==================== Clock Tree ====================
+// Owns the system clock. Clock_Init runs first in main, before any driver is
+// initialized: it either leaves the core on the 16 MHz PIOSC (reset default)
+// or locks the PLL to the 16 MHz crystal and runs the core at
+// 400 MHz / (CLOCK_PLL_SYSDIV2 + 1).
+//
+// The resulting frequency is published in SystemCoreClock (CMSIS). Every
+// driver derives its dividers and tick constants from it (SSI0, I2C0, UART0,
+// SysTick, Timer5 delays, the soft timer and timebase conversions, echo
+// distance), so changing the clock here is the only edit needed.
+//
+// RTE's SystemCoreClockUpdate() does not understand DIV400, so nothing may
+// call it after Clock_Init.
+
+#ifndef CLOCK_USE_PLL
+#define CLOCK_USE_PLL 1
+#endif
+
+#ifndef CLOCK_PLL_SYSDIV2
+#define CLOCK_PLL_SYSDIV2 4              // 400 MHz / 5 = 80 MHz (the part's maximum)
+#endif
+
+#define CLOCK_PIOSC_HZ 16000000
+
+#if CLOCK_USE_PLL
+#define CLOCK_HZ (400000000 / (CLOCK_PLL_SYSDIV2 + 1))
+#else
+#define CLOCK_HZ CLOCK_PIOSC_HZ
+#endif
+
+#if CLOCK_HZ > 80000000 || CLOCK_HZ % 1000000 != 0
+#error "CLOCK_HZ must be a whole number of MHz, at most 80 MHz"
+#endif
+
+// Function prototypes
+void Clock_Init(void);
+uint32_t Clock_Hz(void);
+uint32_t Clock_TicksPerUs(void);
+
+// Configure the system clock and publish it in SystemCoreClock
+void Clock_Init(void) {
+#if CLOCK_USE_PLL
+    SYSCTL_RCC_R &= ~SYSCTL_RCC_MOSCDIS;                 // Start the main oscillator
+    while ((SYSCTL_RIS_R & SYSCTL_RIS_MOSCPUPRIS) == 0); // Wait for it to power up
+
+    SYSCTL_RCC2_R |= SYSCTL_RCC2_USERCC2;                // Use RCC2 for its wider divider
+    SYSCTL_RCC2_R |= SYSCTL_RCC2_BYPASS2;                // Run from the raw clock while the PLL locks
+    SYSCTL_RCC_R = (SYSCTL_RCC_R & ~SYSCTL_RCC_XTAL_M) | SYSCTL_RCC_XTAL_16MHZ;   // 16 MHz crystal
+    SYSCTL_RCC2_R = (SYSCTL_RCC2_R & ~SYSCTL_RCC2_OSCSRC2_M) | SYSCTL_RCC2_OSCSRC2_MO; // PLL input: main oscillator
+    SYSCTL_RCC2_R &= ~SYSCTL_RCC2_PWRDN2;                // Power up the PLL
+    SYSCTL_RCC2_R |= SYSCTL_RCC2_DIV400;                 // Divide the 400 MHz PLL output directly
+    SYSCTL_RCC2_R = (SYSCTL_RCC2_R & ~(SYSCTL_RCC2_SYSDIV2_M | SYSCTL_RCC2_SYSDIV2LSB))
+                  | ((uint32_t)CLOCK_PLL_SYSDIV2 << 22); // SYSDIV2:SYSDIV2LSB as one 7-bit divisor
+    while ((SYSCTL_RIS_R & SYSCTL_RIS_PLLLRIS) == 0);    // Wait for PLL lock
+    SYSCTL_RCC2_R &= ~SYSCTL_RCC2_BYPASS2;               // Switch the core to the PLL
+#endif
+    SystemCoreClock = CLOCK_HZ;
+}
+
+// Current core frequency in Hz
+uint32_t Clock_Hz(void) {
+    return SystemCoreClock;
+}
+
+// Core clock (and 32-bit timer) ticks per microsecond
+uint32_t Clock_TicksPerUs(void) {
+    return SystemCoreClock / 1000000;
+}
+
+#endif // CLOCK_H
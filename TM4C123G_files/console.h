@@ -0,0 +1,310 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <stdint.h>
+#include <string.h>
+#include "uart0.h"
+#include "printHelper.h"
+#include "fmt.h"
+#include "event_loop.h"
+#include "atomic.h"
+#include "log.h"
+#include "profile.h"
+#include "isr_stats.h"
+#include "Stepper_Scan.h"
+
+// ==================== UART0 Command Console ====================
+// UART0_Handler feeds received bytes to Console_RxChar(), which collects a
+// line (CR or LF ends it, backspace edits it) and posts EVT_CONSOLE_LINE.
+// The command runs in Console_HandleEvent() on the app task, so the ranging
+// task still preempts it. Every command answers with one or more lines, the
+// last being "OK" or "ERR <reason>", so a host script can wait for either.
+//
+//   thr [c]              show or set TEMP_THRESHOLD (0..150 C)
+//   scan                 start a scan
+//   range [from to]      show or set the scan range in degrees (-90..90)
+//   res [bins]           show or set the scan resolution (1..MAX_STEPS)
+//   log <module> <lvl>   runtime log level: app temp btn scan, 0..4
+//   stats                counters, profile zones and ISR histograms
+//   help                 list commands
+//
+// A line that arrives before the previous one has been handled, or that
+// finds the event queue full, is dropped and counted. A line whose event was
+// thrown away (EventLoop_Flush before deep sleep) is posted again by
+// Console_Poll(). UART0 is not clocked in deep sleep: commands work while
+// the system is awake.
+
+#define CONSOLE_LINE_MAX 40   // Longest command line
+#define CONSOLE_MAX_ARGS 4    // Command name included
+
+extern volatile uint32_t TEMP_THRESHOLD;
+
+static char consoleRxLine[CONSOLE_LINE_MAX + 1];    // Line being received (ISR only)
+static uint8_t consoleRxLen;
+static uint8_t consoleRxOverflow;                   // Current line too long
+static char consoleCmdLine[CONSOLE_LINE_MAX + 1];   // Complete line for the app task
+static volatile uint8_t consoleCmdReady = 0;
+static volatile uint32_t consoleDropped = 0;        // Lines lost (busy or too long)
+
+typedef struct {
+    const char *name;
+    uint8_t minArgs;      // Arguments after the name
+    uint8_t maxArgs;
+    void (*run)(int argc, char **argv);
+    const char *usage;
+} ConsoleCommand;
+
+// Function prototypes
+void Console_Init(void);
+void Console_RxChar(char c);
+void Console_HandleEvent(const Event *evt);
+void Console_Poll(void);
+
+static void Console_Ok(void) {
+    printString("OK\r\n");
+}
+
+static void Console_Error(const char *reason) {
+    printString("ERR ");
+    printString(reason);
+    printString("\r\n");
+}
+
+// Parse a decimal integer with optional sign; returns 0 if s is not one
+static uint8_t Console_ParseInt(const char *s, int32_t *value) {
+    int32_t sign = 1;
+    int32_t result = 0;
+    uint8_t digits = 0;
+
+    if (*s == '-') {
+        sign = -1;
+        s++;
+    }
+    while (*s >= '0' && *s <= '9') {
+        if (++digits > 9) return 0;             // Keeps result within 32 bits
+        result = result * 10 + (*s++ - '0');
+    }
+    if (*s != '\0' || digits == 0) return 0;
+    *value = sign * result;
+    return 1;
+}
+
+static void Console_Thr(int argc, char **argv) {
+    int32_t value;
+    uint32_t old;
+
+    if (argc == 2) {
+        if (!Console_ParseInt(argv[1], &value) || value < 0 || value > 150) {
+            Console_Error("range 0..150");
+            return;
+        }
+        do {
+            old = TEMP_THRESHOLD;
+        } while (!Atomic_CompareExchange(&TEMP_THRESHOLD, old, (uint32_t)value));
+    }
+    printString("thr ");
+    printInt(TEMP_THRESHOLD);
+    printString("\r\n");
+    Console_Ok();
+}
+
+static void Console_Scan(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    if (StepperMotor_Busy()) {
+        Console_Error("busy");
+    } else if (!EventLoop_Post(EVT_SCAN_REQUEST, 0)) {
+        Console_Error("queue full");
+    } else {
+        Console_Ok();
+    }
+}
+
+static void Console_Range(int argc, char **argv) {
+    int32_t from, to;
+
+    if (argc == 2) {
+        Console_Error("need from and to");
+        return;
+    }
+    if (argc == 3) {
+        if (!Console_ParseInt(argv[1], &from) || !Console_ParseInt(argv[2], &to) ||
+            !StepperMotor_SetRange(from, to)) {
+            Console_Error(StepperMotor_Busy() ? "busy" : "need -90 <= from < to <= 90");
+            return;
+        }
+    }
+    char line[32];
+    char *p = Fmt_Str(line, "range ");
+    p = Fmt_Int(p, scanFromDeg, 0, ' ');
+    p = Fmt_Char(p, ' ');
+    p = Fmt_Int(p, scanToDeg, 0, ' ');
+    Fmt_Str(p, "\r\n");
+    printString(line);
+    Console_Ok();
+}
+
+static void Console_Res(int argc, char **argv) {
+    int32_t bins;
+
+    if (argc == 2) {
+        if (!Console_ParseInt(argv[1], &bins) || !StepperMotor_SetResolution(bins)) {
+            Console_Error(StepperMotor_Busy() ? "busy" : "bins out of range");
+            return;
+        }
+    }
+    printString("res ");
+    printInt(scanBins);
+    printString("\r\n");
+    Console_Ok();
+}
+
+static void Console_Log(int argc, char **argv) {
+    static const char *const names[LOG_MOD_COUNT] = { "app", "temp", "btn", "scan" };
+    int32_t level;
+    (void)argc;
+
+    if (!Console_ParseInt(argv[2], &level) || level < LOG_LEVEL_NONE || level > LOG_LEVEL_TRACE) {
+        Console_Error("level 0..4");
+        return;
+    }
+    for (int i = 0; i < LOG_MOD_COUNT; i++) {
+        if (strcmp(argv[1], names[i]) == 0) {
+            Log_SetLevel((LogModule)i, level);   // Capped at the build's LOG_LEVEL
+            Console_Ok();
+            return;
+        }
+    }
+    Console_Error("module app|temp|btn|scan");
+}
+
+static void Console_PrintCounter(const char *name, uint32_t value) {
+    printString(name);
+    printChar(' ');
+    printInt(value);
+    printString("\r\n");
+}
+
+static void Console_Stats(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    Console_PrintCounter("events_dropped", eventDropped);
+    Console_PrintCounter("uart_tx_dropped", Uart0_Dropped());
+    Console_PrintCounter("uart_rx_errors", Uart0_RxErrors());
+    Console_PrintCounter("console_dropped", consoleDropped);
+    Console_PrintCounter("scan_export_skipped", scanExportSkipped);
+    Console_PrintCounter("range_no_echo", rangeNoEcho);
+    Profile_Dump();
+    IsrStats_Dump();
+    Console_Ok();
+}
+
+static void Console_Help(int argc, char **argv);
+
+static const ConsoleCommand consoleCommands[] = {
+    { "thr",   0, 1, Console_Thr,   "thr [c]" },
+    { "scan",  0, 0, Console_Scan,  "scan" },
+    { "range", 0, 2, Console_Range, "range [from to]" },
+    { "res",   0, 1, Console_Res,   "res [bins]" },
+    { "log",   2, 2, Console_Log,   "log <module> <level>" },
+    { "stats", 0, 0, Console_Stats, "stats" },
+    { "help",  0, 0, Console_Help,  "help" },
+};
+
+#define CONSOLE_COMMAND_COUNT (sizeof(consoleCommands) / sizeof(consoleCommands[0]))
+
+static void Console_Help(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    for (uint32_t i = 0; i < CONSOLE_COMMAND_COUNT; i++) {
+        printString(consoleCommands[i].usage);
+        printString("\r\n");
+    }
+    Console_Ok();
+}
+
+// Split line in place at spaces and run the matching command
+static void Console_Execute(char *line) {
+    char *argv[CONSOLE_MAX_ARGS];
+    int argc = 0;
+
+    while (*line) {
+        while (*line == ' ') *line++ = '\0';
+        if (*line == '\0') break;
+        if (argc == CONSOLE_MAX_ARGS) {
+            Console_Error("too many arguments");
+            return;
+        }
+        argv[argc++] = line;
+        while (*line && *line != ' ') line++;
+    }
+    if (argc == 0) return;
+
+    for (uint32_t i = 0; i < CONSOLE_COMMAND_COUNT; i++) {
+        const ConsoleCommand *cmd = &consoleCommands[i];
+        if (strcmp(argv[0], cmd->name) != 0) continue;
+
+        if (argc - 1 < cmd->minArgs || argc - 1 > cmd->maxArgs) {
+            printString("usage: ");
+            printString(cmd->usage);
+            printString("\r\n");
+            Console_Error("arguments");
+            return;
+        }
+        cmd->run(argc, argv);
+        return;
+    }
+    Console_Error("unknown command");
+}
+
+// Route UART0 receive into the console
+void Console_Init(void) {
+    Uart0_SetRxHandler(Console_RxChar);
+}
+
+// Collect one received character (UART0_Handler context)
+void Console_RxChar(char c) {
+    if (c == '\r' || c == '\n') {
+        if (consoleRxLen == 0 && !consoleRxOverflow) return;   // Empty line or CRLF
+        if (consoleRxOverflow || consoleCmdReady) {
+            consoleDropped++;
+        } else {
+            memcpy(consoleCmdLine, consoleRxLine, consoleRxLen);
+            consoleCmdLine[consoleRxLen] = '\0';
+            consoleCmdReady = 1;
+            if (!EventLoop_Post(EVT_CONSOLE_LINE, 0)) {
+                consoleCmdReady = 0;            // Queue full: lose this line, not the console
+                consoleDropped++;
+            }
+        }
+        consoleRxLen = 0;
+        consoleRxOverflow = 0;
+    } else if (c == '\b' || c == 0x7F) {
+        if (consoleRxLen) consoleRxLen--;
+    } else if (c >= ' ' && c <= '~') {
+        if (consoleRxLen < CONSOLE_LINE_MAX) {
+            consoleRxLine[consoleRxLen++] = c;
+        } else {
+            consoleRxOverflow = 1;
+        }
+    }
+}
+
+// EVT_CONSOLE_LINE: run the waiting command line
+void Console_HandleEvent(const Event *evt) {
+    (void)evt;
+    if (!consoleCmdReady) return;
+    Console_Execute(consoleCmdLine);
+    consoleCmdReady = 0;                        // The ISR may fill the line again
+}
+
+// Post EVT_CONSOLE_LINE again for a line that is waiting, after the event
+// queue has been flushed
+void Console_Poll(void) {
+    if (consoleCmdReady && !EventLoop_Post(EVT_CONSOLE_LINE, 0)) {
+        consoleCmdReady = 0;
+        consoleDropped++;
+    }
+}
+
+#endif // CONSOLE_H
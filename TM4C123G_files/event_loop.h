@@ -0,0 +1,174 @@
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include "TM4C123.h"
+#include <stdint.h>
+#include "kernel.h"
+#include "atomic.h"
+
+// ==================== Cooperative Event Loop ====================
+// ISRs and software-timer callbacks only post events; all real work runs in
+// handlers called one at a time from the app task (run-to-completion). A
+// handler must never block: anything that has to wait arms a software timer
+// that posts the follow-up event. When the queue is empty the app task
+// blocks on eventReady and lower-priority tasks run.
+//
+// An event subscribed with EventLoop_SubscribeTask() runs in another task
+// instead: posts of that type are sent to the task's MsgQueue, and the task
+// dispatches them with EventLoop_RunQueue(). Its handlers follow the same
+// rules. The scan task (Stepper_Scan.h) runs the motion events this way.
+
+// System-wide event identifiers
+typedef enum {
+    EVT_NONE = 0,
+    EVT_WAKE,             // Comparator woke the system from deep sleep
+    EVT_TEMP_SAMPLE,      // Averaging timer: take the next BMP280 sample
+    EVT_TEMP_DONE,        // All FILTER_SIZE samples collected
+    EVT_SCAN_SETTLED,     // Stepper settled after a step, fire the trigger pulse
+    EVT_SCAN_SAMPLE,      // Ranging finished (echo or timeout), store the distance
+    EVT_SCAN_HOLD_DONE,   // Plot has been shown long enough
+    EVT_SCAN_DONE,        // Scan finished and result text is on the LCD
+    EVT_DISPLAY_DONE,     // Result hold time elapsed
+    EVT_STANDBY_TICK,     // Periodic standby temperature refresh
+    EVT_BUTTON,           // Push button records waiting in buttonRing
+    EVT_SLEEP_REQUEST,    // Deep-sleep push button
+    EVT_PROFILE_DUMP,     // Print the profiling table over UART0
+    EVT_CONSOLE_LINE,     // A complete console command line is waiting
+    EVT_SCAN_REQUEST,     // Console asked for a scan
+    EVT_SCAN_START,       // Scan task: start the scan StepperMotor_Scan() asked for
+    EVT_SCAN_STOP,        // Scan task: abort, then post scanStopped
+    EVT_SCAN_PLOT,        // Scan finished: draw the plot (app task)
+    EVT_COUNT
+} EventType;
+
+typedef struct {
+    uint8_t type;         // EventType
+    uint32_t param;       // Event specific argument
+} Event;
+
+typedef void (*EventHandler)(const Event *evt);
+
+// Pack an EventType into the void* argument of a SoftTimerCallback
+#define EVENT_ARG(type) ((void *)(uintptr_t)(type))
+
+#define EVENT_QUEUE_SIZE 16   // Must be a power of two
+
+static Event eventQueue[EVENT_QUEUE_SIZE];
+static volatile uint8_t eventHead = 0;      // Next slot to read
+static volatile uint8_t eventTail = 0;      // Next slot to write
+static volatile uint32_t eventDropped = 0;  // Posts lost to a full queue
+static EventHandler eventHandlers[EVT_COUNT];
+static MsgQueue *eventTaskQueues[EVT_COUNT];           // Set for events run by another task
+static Semaphore eventReady = KERNEL_SEM_INIT(0, 1);   // Posted with every event
+
+// Function prototypes
+void EventLoop_Subscribe(EventType type, EventHandler handler);
+void EventLoop_SubscribeTask(EventType type, EventHandler handler, MsgQueue *queue);
+uint8_t EventLoop_Post(EventType type, uint32_t param);
+void EventLoop_PostFromTimer(void *arg);
+uint8_t EventLoop_DispatchOne(void);
+void EventLoop_Flush(void);
+void EventLoop_Run(void);
+void EventLoop_RunQueue(MsgQueue *queue);
+
+// Register the handler for an event type (one handler per type)
+void EventLoop_Subscribe(EventType type, EventHandler handler) {
+    if (type < EVT_COUNT) {
+        eventHandlers[type] = handler;
+    }
+}
+
+// Register the handler for an event type that runs in the task reading queue
+void EventLoop_SubscribeTask(EventType type, EventHandler handler, MsgQueue *queue) {
+    if (type < EVT_COUNT) {
+        eventHandlers[type] = handler;
+        eventTaskQueues[type] = queue;
+    }
+}
+
+// Queue an event. Safe from ISRs and from main. Returns 0 if the queue is full.
+uint8_t EventLoop_Post(EventType type, uint32_t param) {
+    if (type < EVT_COUNT && eventTaskQueues[type]) {
+        Event evt = { type, param };
+        if (Kernel_QueueSend(eventTaskQueues[type], &evt, 0)) return 1;
+        Atomic_Add(&eventDropped, 1);
+        return 0;
+    }
+
+    uint32_t state = Atomic_Enter();
+
+    uint8_t next = (eventTail + 1) & (EVENT_QUEUE_SIZE - 1);
+    if (next == eventHead) {
+        eventDropped++;
+        Atomic_Exit(state);
+        return 0;
+    }
+    eventQueue[eventTail].type = type;
+    eventQueue[eventTail].param = param;
+    eventTail = next;
+
+    Atomic_Exit(state);
+    Kernel_SemPost(&eventReady);
+    return 1;
+}
+
+// SoftTimerCallback adapter: arg carries the EventType to post
+void EventLoop_PostFromTimer(void *arg) {
+    EventLoop_Post((EventType)(uintptr_t)arg, 0);
+}
+
+// Run the handler for an event
+static void EventLoop_Dispatch(const Event *evt) {
+    if (evt->type < EVT_COUNT && eventHandlers[evt->type]) {
+        eventHandlers[evt->type](evt);
+    }
+}
+
+// Run the handler for one queued event. Returns 0 if the queue was empty.
+uint8_t EventLoop_DispatchOne(void) {
+    Event evt;
+
+    uint32_t state = Atomic_Enter();
+    if (eventHead == eventTail) {
+        Atomic_Exit(state);
+        return 0;
+    }
+    evt = eventQueue[eventHead];
+    eventHead = (eventHead + 1) & (EVENT_QUEUE_SIZE - 1);
+    Atomic_Exit(state);
+
+    EventLoop_Dispatch(&evt);
+    return 1;
+}
+
+// Discard every event queued for the app task (used before deep sleep so
+// nothing stale runs on wake). Task queues keep theirs; their handlers
+// ignore events that no longer match their state.
+void EventLoop_Flush(void) {
+    uint32_t state = Atomic_Enter();
+    eventHead = eventTail;
+    Atomic_Exit(state);
+}
+
+// Dispatch forever (app task); block whenever there is nothing to do.
+// A post between the last dispatch and the wait leaves eventReady set, so
+// it is not missed.
+void EventLoop_Run(void) {
+    while (1) {
+        while (EventLoop_DispatchOne());
+        Kernel_SemWait(&eventReady, KERNEL_WAIT_FOREVER);
+    }
+}
+
+// Dispatch the events sent to queue forever (a task subscribed with
+// EventLoop_SubscribeTask); block while it is empty
+void EventLoop_RunQueue(MsgQueue *queue) {
+    Event evt;
+
+    while (1) {
+        Kernel_QueueReceive(queue, &evt, KERNEL_WAIT_FOREVER);
+        EventLoop_Dispatch(&evt);
+    }
+}
+
+#endif // EVENT_LOOP_H
@@ -0,0 +1,121 @@
+#ifndef FMT_H
+#define FMT_H
+
+#include <stdint.h>
+#include <float.h>
+
+// ==================== Number Formatting ====================
+// Small replacements for sprintf/printFloat. Every function appends to a
+// caller buffer, writes the terminating '\0' and returns a pointer to it, so
+// calls chain:
+//
+//   char *p = Fmt_Str(buf, "Temp: ");
+//   p = Fmt_Float(p, t, 2);                 // "Temp: 20.05"
+//
+// No allocation, no locale, no float printf library. The caller sizes the
+// buffer: a number takes at most 11 characters plus padding, and
+// Fmt_Fixed/Fmt_Float at most 11 + 1 + decimals. Fmt_Float prints "nan",
+// "inf"/"-inf", and "ovf"/"-ovf" for finite values too big for 31 bits
+// once scaled, instead of a wrong number.
+
+#define FMT_MAX_DECIMALS 9
+#define FMT_FLOAT_LIMIT  2147483520.0f   // Largest float below 2^31
+
+// Function prototypes
+char *Fmt_Str(char *out, const char *s);
+char *Fmt_Char(char *out, char c);
+char *Fmt_Uint(char *out, uint32_t value, uint8_t width, char pad);
+char *Fmt_Int(char *out, int32_t value, uint8_t width, char pad);
+char *Fmt_Fixed(char *out, int32_t value, uint8_t decimals);
+char *Fmt_Float(char *out, float value, uint8_t decimals);
+
+static const uint32_t fmtPow10[FMT_MAX_DECIMALS + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// Append a string
+char *Fmt_Str(char *out, const char *s) {
+    while (*s) {
+        *out++ = *s++;
+    }
+    *out = '\0';
+    return out;
+}
+
+// Append one character
+char *Fmt_Char(char *out, char c) {
+    *out++ = c;
+    *out = '\0';
+    return out;
+}
+
+// Digits of value with an optional sign, right-aligned in width with pad
+// (' ' or '0'; zero padding goes after the sign)
+static char *Fmt_Digits(char *out, uint32_t value, char sign, uint8_t width, char pad) {
+    char digits[10];
+    uint8_t n = 0;
+    uint8_t len;
+
+    do {
+        digits[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+
+    len = n + (sign ? 1 : 0);
+    if (pad != '0') {
+        for (; len < width; len++) *out++ = pad;
+    }
+    if (sign) *out++ = sign;
+    if (pad == '0') {
+        for (; len < width; len++) *out++ = '0';
+    }
+    while (n) {
+        *out++ = digits[--n];
+    }
+    *out = '\0';
+    return out;
+}
+
+// Append an unsigned decimal, at least width characters
+char *Fmt_Uint(char *out, uint32_t value, uint8_t width, char pad) {
+    return Fmt_Digits(out, value, 0, width, pad);
+}
+
+// Append a signed decimal, at least width characters
+char *Fmt_Int(char *out, int32_t value, uint8_t width, char pad) {
+    uint32_t magnitude = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+    return Fmt_Digits(out, magnitude, (value < 0) ? '-' : 0, width, pad);
+}
+
+// Append value / 10^decimals with exactly decimals fraction digits,
+// e.g. (2005, 2) -> "20.05", (-5, 2) -> "-0.05"
+char *Fmt_Fixed(char *out, int32_t value, uint8_t decimals) {
+    uint32_t magnitude = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+
+    if (decimals > FMT_MAX_DECIMALS) decimals = FMT_MAX_DECIMALS;
+    if (value < 0) *out++ = '-';
+    out = Fmt_Digits(out, magnitude / fmtPow10[decimals], 0, 0, ' ');
+    if (decimals) {
+        *out++ = '.';
+        out = Fmt_Digits(out, magnitude % fmtPow10[decimals], 0, decimals, '0');
+    }
+    return out;
+}
+
+// Append a float rounded half away from zero to decimals digits
+char *Fmt_Float(char *out, float value, uint8_t decimals) {
+    float scaled;
+
+    if (decimals > FMT_MAX_DECIMALS) decimals = FMT_MAX_DECIMALS;
+    if (value != value) return Fmt_Str(out, "nan");
+    if (value > FLT_MAX) return Fmt_Str(out, "inf");
+    if (value < -FLT_MAX) return Fmt_Str(out, "-inf");
+
+    scaled = value * (float)fmtPow10[decimals];
+    scaled += (scaled < 0.0f) ? -0.5f : 0.5f;
+    if (scaled > FMT_FLOAT_LIMIT) return Fmt_Str(out, "ovf");     // Does not fit Fmt_Fixed
+    if (scaled < -FMT_FLOAT_LIMIT) return Fmt_Str(out, "-ovf");
+    return Fmt_Fixed(out, (int32_t)scaled, decimals);
+}
+
+#endif // FMT_H
@@ -0,0 +1,97 @@
+#ifndef FONT_H
+#define FONT_H
+
+#include <stdint.h>
+#include "Nokia5110.h"
+#include "gfx.h"
+
+// ==================== Framebuffer Text ====================
+// Text drawn into the Screen buffer at any pixel position, so it can share a
+// frame with gfx.h drawings and only the covered columns are resent.
+//
+// Glyph tables are generated from host/fonts/*.fnt by host/fontgen.cpp and
+// committed; after editing a font, rerun it with the host build's "fonts"
+// target. Each glyph is stored eight times, moved
+// down by 0..7 pixels, as bank-row bytes: drawing at row y picks copy y & 7
+// and writes whole bytes into the banks it covers, with no per-pixel work.
+// A font of height h keeps (h + 14) / 8 bank rows per copy.
+//
+//   font_5x8.h       the Nokia5110 5x8 character set, 0x20-0x7F
+//   font_digits16.h  10x16 digits, + - . : space C and the degree sign 0xB0
+//
+// x, y is the top-left pixel of the first glyph. Characters a font has no
+// glyph for are skipped. Like gfx.h: draw from one context between
+// Lcd_BeginFrame() and Lcd_ShowFrame().
+
+#define FONT_NO_GLYPH 0xFF
+#define FONT_DEGREE   "\xB0"           // Degree sign in font_digits16.h
+
+typedef struct {
+    uint8_t height;                    // Pixel rows
+    uint8_t stride;                    // Columns stored per glyph (widest glyph)
+    uint8_t rows;                      // Bank rows per shifted copy
+    uint8_t spacing;                   // Blank columns after each glyph
+    uint8_t first;                     // Character code of index[0]
+    uint8_t count;                     // Entries in index
+    const uint8_t *index;              // Glyph number per code, FONT_NO_GLYPH if none
+    const uint8_t *width;              // Columns per glyph
+    const uint8_t *glyphs;             // [glyph][shift 0-7][row][stride]
+} Font;
+
+// Function prototypes
+int32_t Font_DrawChar(const Font *font, int32_t x, int32_t y, char c, uint8_t color);
+int32_t Font_DrawString(const Font *font, int32_t x, int32_t y, const char *s, uint8_t color);
+int32_t Font_StringWidth(const Font *font, const char *s);
+
+// Glyph number of c, FONT_NO_GLYPH if the font lacks it
+static inline uint8_t Font_Glyph(const Font *font, char c) {
+    uint32_t i = (uint8_t)c - (uint32_t)font->first;
+    return i < font->count ? font->index[i] : FONT_NO_GLYPH;
+}
+
+// Draw one character with its top-left pixel at (x, y); returns the advance
+int32_t Font_DrawChar(const Font *font, int32_t x, int32_t y, char c, uint8_t color) {
+    uint8_t glyph = Font_Glyph(font, c);
+    if (glyph == FONT_NO_GLYPH) return 0;
+
+    int32_t width = font->width[glyph];
+    int32_t shift = y & 7;
+    int32_t bank0 = (y - shift) / 8;   // Floor, also for y < 0
+    int32_t c0 = x < 0 ? -x : 0;       // Visible glyph columns c0..c1
+    int32_t c1 = x + width > GFX_WIDTH ? GFX_WIDTH - x - 1 : width - 1;
+
+    if (c0 <= c1 && y < GFX_HEIGHT && y + font->height > 0) {
+        const uint8_t *src = font->glyphs
+                           + ((uint32_t)glyph * 8 + shift) * font->rows * font->stride;
+        for (int32_t row = 0; row < font->rows; row++, src += font->stride) {
+            int32_t bank = bank0 + row;
+            if ((uint32_t)bank >= GFX_BANKS) continue;
+            uint8_t *p = &Screen[GFX_WIDTH * bank + x + c0];
+            for (int32_t col = c0; col <= c1; col++, p++) {
+                if (src[col]) Gfx_Apply(p, src[col], color);
+            }
+        }
+        Gfx_MarkDirty(x + c0, y, x + c1, y + font->height - 1);
+    }
+    return width + font->spacing;
+}
+
+// Draw a string left to right from (x, y); returns x after the last advance
+int32_t Font_DrawString(const Font *font, int32_t x, int32_t y, const char *s, uint8_t color) {
+    while (*s && x < GFX_WIDTH) {
+        x += Font_DrawChar(font, x, y, *s++, color);
+    }
+    return x;
+}
+
+// Pixel width of a string, without the spacing after its last glyph
+int32_t Font_StringWidth(const Font *font, const char *s) {
+    int32_t w = 0;
+    while (*s) {
+        uint8_t glyph = Font_Glyph(font, *s++);
+        if (glyph != FONT_NO_GLYPH) w += font->width[glyph] + font->spacing;
+    }
+    return w > 0 ? w - font->spacing : 0;
+}
+
+#endif // FONT_H
@@ -0,0 +1,1671 @@
+// font_5x8.h
+// Generated by host/fontgen.cpp from fonts/ascii5x8.fnt; do not edit.
+// 96 glyphs, 8 rows, 2 bank rows per shift.
+
+#ifndef FONT_5X8_H
+#define FONT_5X8_H
+
+#include "font.h"
+
+// Glyph number per character code from 0x20 (FONT_NO_GLYPH: none)
+static const uint8_t font5x8Index[96] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,   // 0x20
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,   // 0x30
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,   // 0x40
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,   // 0x50
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,   // 0x60
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,   // 0x70
+};
+
+// Columns per glyph
+static const uint8_t font5x8Width[96] = {
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+};
+
+// [glyph][shift 0-7][bank row 0-1][column 0-4]
+static const uint8_t font5x8Glyphs[96 * 8 * 2 * 5] = {
+    // 0x20 space
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // 0x21 !
+    0x00, 0x00, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0x00, 0x00,
+    // 0x22 "
+    0x00, 0x07, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x00, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00,
+    0x00, 0x03, 0x00, 0x03, 0x00,
+    // 0x23 #
+    0x14, 0x7F, 0x14, 0x7F, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0xFE, 0x28, 0xFE, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFC, 0x50, 0xFC, 0x50,
+    0x00, 0x01, 0x00, 0x01, 0x00,
+    0xA0, 0xF8, 0xA0, 0xF8, 0xA0,
+    0x00, 0x03, 0x00, 0x03, 0x00,
+    0x40, 0xF0, 0x40, 0xF0, 0x40,
+    0x01, 0x07, 0x01, 0x07, 0x01,
+    0x80, 0xE0, 0x80, 0xE0, 0x80,
+    0x02, 0x0F, 0x02, 0x0F, 0x02,
+    0x00, 0xC0, 0x00, 0xC0, 0x00,
+    0x05, 0x1F, 0x05, 0x1F, 0x05,
+    0x00, 0x80, 0x00, 0x80, 0x00,
+    0x0A, 0x3F, 0x0A, 0x3F, 0x0A,
+    // 0x24 $
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x54, 0xFE, 0x54, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xA8, 0xFC, 0xA8, 0x48,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0x20, 0x50, 0xF8, 0x50, 0x90,
+    0x01, 0x01, 0x03, 0x01, 0x00,
+    0x40, 0xA0, 0xF0, 0xA0, 0x20,
+    0x02, 0x02, 0x07, 0x02, 0x01,
+    0x80, 0x40, 0xE0, 0x40, 0x40,
+    0x04, 0x05, 0x0F, 0x05, 0x02,
+    0x00, 0x80, 0xC0, 0x80, 0x80,
+    0x09, 0x0A, 0x1F, 0x0A, 0x04,
+    0x00, 0x00, 0x80, 0x00, 0x00,
+    0x12, 0x15, 0x3F, 0x15, 0x09,
+    // 0x25 %
+    0x23, 0x13, 0x08, 0x64, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x46, 0x26, 0x10, 0xC8, 0xC4,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8C, 0x4C, 0x20, 0x90, 0x88,
+    0x00, 0x00, 0x00, 0x01, 0x01,
+    0x18, 0x98, 0x40, 0x20, 0x10,
+    0x01, 0x00, 0x00, 0x03, 0x03,
+    0x30, 0x30, 0x80, 0x40, 0x20,
+    0x02, 0x01, 0x00, 0x06, 0x06,
+    0x60, 0x60, 0x00, 0x80, 0x40,
+    0x04, 0x02, 0x01, 0x0C, 0x0C,
+    0xC0, 0xC0, 0x00, 0x00, 0x80,
+    0x08, 0x04, 0x02, 0x19, 0x18,
+    0x80, 0x80, 0x00, 0x00, 0x00,
+    0x11, 0x09, 0x04, 0x32, 0x31,
+    // 0x26 &
+    0x36, 0x49, 0x55, 0x22, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6C, 0x92, 0xAA, 0x44, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD8, 0x24, 0x54, 0x88, 0x40,
+    0x00, 0x01, 0x01, 0x00, 0x01,
+    0xB0, 0x48, 0xA8, 0x10, 0x80,
+    0x01, 0x02, 0x02, 0x01, 0x02,
+    0x60, 0x90, 0x50, 0x20, 0x00,
+    0x03, 0x04, 0x05, 0x02, 0x05,
+    0xC0, 0x20, 0xA0, 0x40, 0x00,
+    0x06, 0x09, 0x0A, 0x04, 0x0A,
+    0x80, 0x40, 0x40, 0x80, 0x00,
+    0x0D, 0x12, 0x15, 0x08, 0x14,
+    0x00, 0x80, 0x80, 0x00, 0x00,
+    0x1B, 0x24, 0x2A, 0x11, 0x28,
+    // 0x27 '
+    0x00, 0x05, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xC0, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00,
+    // 0x28 (
+    0x00, 0x1C, 0x22, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x44, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0xE0, 0x10, 0x08, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0xC0, 0x20, 0x10, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x00,
+    0x00, 0x80, 0x40, 0x20, 0x00,
+    0x00, 0x03, 0x04, 0x08, 0x00,
+    0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0x07, 0x08, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x0E, 0x11, 0x20, 0x00,
+    // 0x29 )
+    0x00, 0x41, 0x22, 0x1C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x82, 0x44, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x88, 0x70, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x10, 0xE0, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x10, 0x20, 0xC0, 0x00,
+    0x00, 0x04, 0x02, 0x01, 0x00,
+    0x00, 0x20, 0x40, 0x80, 0x00,
+    0x00, 0x08, 0x04, 0x03, 0x00,
+    0x00, 0x40, 0x80, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x07, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x11, 0x0E, 0x00,
+    // 0x2A *
+    0x14, 0x08, 0x3E, 0x08, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x10, 0x7C, 0x10, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x20, 0xF8, 0x20, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0x40, 0xF0, 0x40, 0xA0,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0x40, 0x80, 0xE0, 0x80, 0x40,
+    0x01, 0x00, 0x03, 0x00, 0x01,
+    0x80, 0x00, 0xC0, 0x00, 0x80,
+    0x02, 0x01, 0x07, 0x01, 0x02,
+    0x00, 0x00, 0x80, 0x00, 0x00,
+    0x05, 0x02, 0x0F, 0x02, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x04, 0x1F, 0x04, 0x0A,
+    // 0x2B +
+    0x08, 0x08, 0x3E, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x7C, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0xF8, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0xF0, 0x40, 0x40,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0x80, 0x80, 0xE0, 0x80, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00,
+    0x01, 0x01, 0x07, 0x01, 0x01,
+    0x00, 0x00, 0x80, 0x00, 0x00,
+    0x02, 0x02, 0x0F, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x1F, 0x04, 0x04,
+    // 0x2C ,
+    0x00, 0x50, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xC0, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x28, 0x18, 0x00, 0x00,
+    // 0x2D -
+    0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04,
+    // 0x2E .
+    0x00, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x30, 0x00, 0x00,
+    // 0x2F /
+    0x20, 0x10, 0x08, 0x04, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x20, 0x10, 0x08, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x40, 0x20, 0x10, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x40, 0x20, 0x10,
+    0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x40, 0x20,
+    0x02, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x40,
+    0x04, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80,
+    0x08, 0x04, 0x02, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x04, 0x02, 0x01,
+    // 0x30 0
+    0x3E, 0x51, 0x49, 0x45, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0xA2, 0x92, 0x8A, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x44, 0x24, 0x14, 0xF8,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xF0, 0x88, 0x48, 0x28, 0xF0,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0xE0, 0x10, 0x90, 0x50, 0xE0,
+    0x03, 0x05, 0x04, 0x04, 0x03,
+    0xC0, 0x20, 0x20, 0xA0, 0xC0,
+    0x07, 0x0A, 0x09, 0x08, 0x07,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x0F, 0x14, 0x12, 0x11, 0x0F,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x1F, 0x28, 0x24, 0x22, 0x1F,
+    // 0x31 1
+    0x00, 0x42, 0x7F, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x84, 0xFE, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xFC, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x10, 0xF8, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x02, 0x00,
+    0x00, 0x20, 0xF0, 0x00, 0x00,
+    0x00, 0x04, 0x07, 0x04, 0x00,
+    0x00, 0x40, 0xE0, 0x00, 0x00,
+    0x00, 0x08, 0x0F, 0x08, 0x00,
+    0x00, 0x80, 0xC0, 0x00, 0x00,
+    0x00, 0x10, 0x1F, 0x10, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x21, 0x3F, 0x20, 0x00,
+    // 0x32 2
+    0x42, 0x61, 0x51, 0x49, 0x46,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0xC2, 0xA2, 0x92, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x84, 0x44, 0x24, 0x18,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    0x10, 0x08, 0x88, 0x48, 0x30,
+    0x02, 0x03, 0x02, 0x02, 0x02,
+    0x20, 0x10, 0x10, 0x90, 0x60,
+    0x04, 0x06, 0x05, 0x04, 0x04,
+    0x40, 0x20, 0x20, 0x20, 0xC0,
+    0x08, 0x0C, 0x0A, 0x09, 0x08,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x10, 0x18, 0x14, 0x12, 0x11,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x21, 0x30, 0x28, 0x24, 0x23,
+    // 0x33 3
+    0x21, 0x41, 0x45, 0x4B, 0x31,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x42, 0x82, 0x8A, 0x96, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x04, 0x14, 0x2C, 0xC4,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x08, 0x08, 0x28, 0x58, 0x88,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0x10, 0x10, 0x50, 0xB0, 0x10,
+    0x02, 0x04, 0x04, 0x04, 0x03,
+    0x20, 0x20, 0xA0, 0x60, 0x20,
+    0x04, 0x08, 0x08, 0x09, 0x06,
+    0x40, 0x40, 0x40, 0xC0, 0x40,
+    0x08, 0x10, 0x11, 0x12, 0x0C,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x10, 0x20, 0x22, 0x25, 0x18,
+    // 0x34 4
+    0x18, 0x14, 0x12, 0x7F, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x28, 0x24, 0xFE, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x50, 0x48, 0xFC, 0x40,
+    0x00, 0x00, 0x00, 0x01, 0x00,
+    0xC0, 0xA0, 0x90, 0xF8, 0x80,
+    0x00, 0x00, 0x00, 0x03, 0x00,
+    0x80, 0x40, 0x20, 0xF0, 0x00,
+    0x01, 0x01, 0x01, 0x07, 0x01,
+    0x00, 0x80, 0x40, 0xE0, 0x00,
+    0x03, 0x02, 0x02, 0x0F, 0x02,
+    0x00, 0x00, 0x80, 0xC0, 0x00,
+    0x06, 0x05, 0x04, 0x1F, 0x04,
+    0x00, 0x00, 0x00, 0x80, 0x00,
+    0x0C, 0x0A, 0x09, 0x3F, 0x08,
+    // 0x35 5
+    0x27, 0x45, 0x45, 0x45, 0x39,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x8A, 0x8A, 0x8A, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9C, 0x14, 0x14, 0x14, 0xE4,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x38, 0x28, 0x28, 0x28, 0xC8,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0x70, 0x50, 0x50, 0x50, 0x90,
+    0x02, 0x04, 0x04, 0x04, 0x03,
+    0xE0, 0xA0, 0xA0, 0xA0, 0x20,
+    0x04, 0x08, 0x08, 0x08, 0x07,
+    0xC0, 0x40, 0x40, 0x40, 0x40,
+    0x09, 0x11, 0x11, 0x11, 0x0E,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x13, 0x22, 0x22, 0x22, 0x1C,
+    // 0x36 6
+    0x3C, 0x4A, 0x49, 0x49, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x94, 0x92, 0x92, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x28, 0x24, 0x24, 0xC0,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xE0, 0x50, 0x48, 0x48, 0x80,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0xC0, 0xA0, 0x90, 0x90, 0x00,
+    0x03, 0x04, 0x04, 0x04, 0x03,
+    0x80, 0x40, 0x20, 0x20, 0x00,
+    0x07, 0x09, 0x09, 0x09, 0x06,
+    0x00, 0x80, 0x40, 0x40, 0x00,
+    0x0F, 0x12, 0x12, 0x12, 0x0C,
+    0x00, 0x00, 0x80, 0x80, 0x00,
+    0x1E, 0x25, 0x24, 0x24, 0x18,
+    // 0x37 7
+    0x01, 0x71, 0x09, 0x05, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0xE2, 0x12, 0x0A, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xC4, 0x24, 0x14, 0x0C,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+    0x08, 0x88, 0x48, 0x28, 0x18,
+    0x00, 0x03, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x90, 0x50, 0x30,
+    0x00, 0x07, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0xA0, 0x60,
+    0x00, 0x0E, 0x01, 0x00, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0xC0,
+    0x00, 0x1C, 0x02, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x38, 0x04, 0x02, 0x01,
+    // 0x38 8
+    0x36, 0x49, 0x49, 0x49, 0x36,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6C, 0x92, 0x92, 0x92, 0x6C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD8, 0x24, 0x24, 0x24, 0xD8,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xB0, 0x48, 0x48, 0x48, 0xB0,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0x60, 0x90, 0x90, 0x90, 0x60,
+    0x03, 0x04, 0x04, 0x04, 0x03,
+    0xC0, 0x20, 0x20, 0x20, 0xC0,
+    0x06, 0x09, 0x09, 0x09, 0x06,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x0D, 0x12, 0x12, 0x12, 0x0D,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x1B, 0x24, 0x24, 0x24, 0x1B,
+    // 0x39 9
+    0x06, 0x49, 0x49, 0x29, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0x92, 0x92, 0x52, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x24, 0x24, 0xA4, 0x78,
+    0x00, 0x01, 0x01, 0x00, 0x00,
+    0x30, 0x48, 0x48, 0x48, 0xF0,
+    0x00, 0x02, 0x02, 0x01, 0x00,
+    0x60, 0x90, 0x90, 0x90, 0xE0,
+    0x00, 0x04, 0x04, 0x02, 0x01,
+    0xC0, 0x20, 0x20, 0x20, 0xC0,
+    0x00, 0x09, 0x09, 0x05, 0x03,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x01, 0x12, 0x12, 0x0A, 0x07,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x03, 0x24, 0x24, 0x14, 0x0F,
+    // 0x3A :
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6C, 0x6C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD8, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xB0, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0D, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1B, 0x1B, 0x00, 0x00,
+    // 0x3B ;
+    0x00, 0x56, 0x36, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAC, 0x6C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x58, 0xD8, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xB0, 0x00, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x05, 0x03, 0x00, 0x00,
+    0x00, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0x0A, 0x06, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x15, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2B, 0x1B, 0x00, 0x00,
+    // 0x3C <
+    0x08, 0x14, 0x22, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x28, 0x44, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x50, 0x88, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00,
+    0x40, 0xA0, 0x10, 0x08, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x00,
+    0x80, 0x40, 0x20, 0x10, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x00,
+    0x00, 0x80, 0x40, 0x20, 0x00,
+    0x01, 0x02, 0x04, 0x08, 0x00,
+    0x00, 0x00, 0x80, 0x40, 0x00,
+    0x02, 0x05, 0x08, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00,
+    0x04, 0x0A, 0x11, 0x20, 0x00,
+    // 0x3D =
+    0x14, 0x14, 0x14, 0x14, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x28, 0x28, 0x28, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0x50, 0x50, 0x50, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x05, 0x05, 0x05, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    // 0x3E >
+    0x00, 0x41, 0x22, 0x14, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x82, 0x44, 0x28, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x88, 0x50, 0x20,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x10, 0xA0, 0x40,
+    0x00, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x10, 0x20, 0x40, 0x80,
+    0x00, 0x04, 0x02, 0x01, 0x00,
+    0x00, 0x20, 0x40, 0x80, 0x00,
+    0x00, 0x08, 0x04, 0x02, 0x01,
+    0x00, 0x40, 0x80, 0x00, 0x00,
+    0x00, 0x10, 0x08, 0x05, 0x02,
+    0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x11, 0x0A, 0x04,
+    // 0x3F ?
+    0x02, 0x01, 0x51, 0x09, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x02, 0xA2, 0x12, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x04, 0x44, 0x24, 0x18,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0x10, 0x08, 0x88, 0x48, 0x30,
+    0x00, 0x00, 0x02, 0x00, 0x00,
+    0x20, 0x10, 0x10, 0x90, 0x60,
+    0x00, 0x00, 0x05, 0x00, 0x00,
+    0x40, 0x20, 0x20, 0x20, 0xC0,
+    0x00, 0x00, 0x0A, 0x01, 0x00,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x00, 0x00, 0x14, 0x02, 0x01,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x01, 0x00, 0x28, 0x04, 0x03,
+    // 0x40 @
+    0x32, 0x49, 0x79, 0x41, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x64, 0x92, 0xF2, 0x82, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC8, 0x24, 0xE4, 0x04, 0xF8,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x90, 0x48, 0xC8, 0x08, 0xF0,
+    0x01, 0x02, 0x03, 0x02, 0x01,
+    0x20, 0x90, 0x90, 0x10, 0xE0,
+    0x03, 0x04, 0x07, 0x04, 0x03,
+    0x40, 0x20, 0x20, 0x20, 0xC0,
+    0x06, 0x09, 0x0F, 0x08, 0x07,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x0C, 0x12, 0x1E, 0x10, 0x0F,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x19, 0x24, 0x3C, 0x20, 0x1F,
+    // 0x41 A
+    0x7E, 0x11, 0x11, 0x11, 0x7E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x22, 0x22, 0x22, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x44, 0x44, 0x44, 0xF8,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xF0, 0x88, 0x88, 0x88, 0xF0,
+    0x03, 0x00, 0x00, 0x00, 0x03,
+    0xE0, 0x10, 0x10, 0x10, 0xE0,
+    0x07, 0x01, 0x01, 0x01, 0x07,
+    0xC0, 0x20, 0x20, 0x20, 0xC0,
+    0x0F, 0x02, 0x02, 0x02, 0x0F,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x1F, 0x04, 0x04, 0x04, 0x1F,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x3F, 0x08, 0x08, 0x08, 0x3F,
+    // 0x42 B
+    0x7F, 0x49, 0x49, 0x49, 0x36,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x92, 0x92, 0x92, 0x6C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x24, 0x24, 0x24, 0xD8,
+    0x01, 0x01, 0x01, 0x01, 0x00,
+    0xF8, 0x48, 0x48, 0x48, 0xB0,
+    0x03, 0x02, 0x02, 0x02, 0x01,
+    0xF0, 0x90, 0x90, 0x90, 0x60,
+    0x07, 0x04, 0x04, 0x04, 0x03,
+    0xE0, 0x20, 0x20, 0x20, 0xC0,
+    0x0F, 0x09, 0x09, 0x09, 0x06,
+    0xC0, 0x40, 0x40, 0x40, 0x80,
+    0x1F, 0x12, 0x12, 0x12, 0x0D,
+    0x80, 0x80, 0x80, 0x80, 0x00,
+    0x3F, 0x24, 0x24, 0x24, 0x1B,
+    // 0x43 C
+    0x3E, 0x41, 0x41, 0x41, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x82, 0x82, 0x82, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x04, 0x04, 0x04, 0x88,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xF0, 0x08, 0x08, 0x08, 0x10,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0xE0, 0x10, 0x10, 0x10, 0x20,
+    0x03, 0x04, 0x04, 0x04, 0x02,
+    0xC0, 0x20, 0x20, 0x20, 0x40,
+    0x07, 0x08, 0x08, 0x08, 0x04,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x0F, 0x10, 0x10, 0x10, 0x08,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x1F, 0x20, 0x20, 0x20, 0x11,
+    // 0x44 D
+    0x7F, 0x41, 0x41, 0x22, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x82, 0x82, 0x44, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x04, 0x04, 0x88, 0x70,
+    0x01, 0x01, 0x01, 0x00, 0x00,
+    0xF8, 0x08, 0x08, 0x10, 0xE0,
+    0x03, 0x02, 0x02, 0x01, 0x00,
+    0xF0, 0x10, 0x10, 0x20, 0xC0,
+    0x07, 0x04, 0x04, 0x02, 0x01,
+    0xE0, 0x20, 0x20, 0x40, 0x80,
+    0x0F, 0x08, 0x08, 0x04, 0x03,
+    0xC0, 0x40, 0x40, 0x80, 0x00,
+    0x1F, 0x10, 0x10, 0x08, 0x07,
+    0x80, 0x80, 0x80, 0x00, 0x00,
+    0x3F, 0x20, 0x20, 0x11, 0x0E,
+    // 0x45 E
+    0x7F, 0x49, 0x49, 0x49, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x92, 0x92, 0x92, 0x82,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x24, 0x24, 0x24, 0x04,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    0xF8, 0x48, 0x48, 0x48, 0x08,
+    0x03, 0x02, 0x02, 0x02, 0x02,
+    0xF0, 0x90, 0x90, 0x90, 0x10,
+    0x07, 0x04, 0x04, 0x04, 0x04,
+    0xE0, 0x20, 0x20, 0x20, 0x20,
+    0x0F, 0x09, 0x09, 0x09, 0x08,
+    0xC0, 0x40, 0x40, 0x40, 0x40,
+    0x1F, 0x12, 0x12, 0x12, 0x10,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x3F, 0x24, 0x24, 0x24, 0x20,
+    // 0x46 F
+    0x7F, 0x09, 0x09, 0x09, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x12, 0x12, 0x12, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x24, 0x24, 0x24, 0x04,
+    0x01, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x48, 0x48, 0x48, 0x08,
+    0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x90, 0x90, 0x90, 0x10,
+    0x07, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x20, 0x20, 0x20, 0x20,
+    0x0F, 0x01, 0x01, 0x01, 0x00,
+    0xC0, 0x40, 0x40, 0x40, 0x40,
+    0x1F, 0x02, 0x02, 0x02, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x3F, 0x04, 0x04, 0x04, 0x00,
+    // 0x47 G
+    0x3E, 0x41, 0x49, 0x49, 0x7A,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x82, 0x92, 0x92, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x04, 0x24, 0x24, 0xE8,
+    0x00, 0x01, 0x01, 0x01, 0x01,
+    0xF0, 0x08, 0x48, 0x48, 0xD0,
+    0x01, 0x02, 0x02, 0x02, 0x03,
+    0xE0, 0x10, 0x90, 0x90, 0xA0,
+    0x03, 0x04, 0x04, 0x04, 0x07,
+    0xC0, 0x20, 0x20, 0x20, 0x40,
+    0x07, 0x08, 0x09, 0x09, 0x0F,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x0F, 0x10, 0x12, 0x12, 0x1E,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x1F, 0x20, 0x24, 0x24, 0x3D,
+    // 0x48 H
+    0x7F, 0x08, 0x08, 0x08, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x10, 0x10, 0x10, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x20, 0x20, 0x20, 0xFC,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xF8, 0x40, 0x40, 0x40, 0xF8,
+    0x03, 0x00, 0x00, 0x00, 0x03,
+    0xF0, 0x80, 0x80, 0x80, 0xF0,
+    0x07, 0x00, 0x00, 0x00, 0x07,
+    0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x0F, 0x01, 0x01, 0x01, 0x0F,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x1F, 0x02, 0x02, 0x02, 0x1F,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x3F, 0x04, 0x04, 0x04, 0x3F,
+    // 0x49 I
+    0x00, 0x41, 0x7F, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x82, 0xFE, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFC, 0x04, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x08, 0xF8, 0x08, 0x00,
+    0x00, 0x02, 0x03, 0x02, 0x00,
+    0x00, 0x10, 0xF0, 0x10, 0x00,
+    0x00, 0x04, 0x07, 0x04, 0x00,
+    0x00, 0x20, 0xE0, 0x20, 0x00,
+    0x00, 0x08, 0x0F, 0x08, 0x00,
+    0x00, 0x40, 0xC0, 0x40, 0x00,
+    0x00, 0x10, 0x1F, 0x10, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x20, 0x3F, 0x20, 0x00,
+    // 0x4A J
+    0x20, 0x40, 0x41, 0x3F, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x80, 0x82, 0x7E, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x04, 0xFC, 0x04,
+    0x00, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xF8, 0x08,
+    0x01, 0x02, 0x02, 0x01, 0x00,
+    0x00, 0x00, 0x10, 0xF0, 0x10,
+    0x02, 0x04, 0x04, 0x03, 0x00,
+    0x00, 0x00, 0x20, 0xE0, 0x20,
+    0x04, 0x08, 0x08, 0x07, 0x00,
+    0x00, 0x00, 0x40, 0xC0, 0x40,
+    0x08, 0x10, 0x10, 0x0F, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0x80,
+    0x10, 0x20, 0x20, 0x1F, 0x00,
+    // 0x4B K
+    0x7F, 0x08, 0x14, 0x22, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x10, 0x28, 0x44, 0x82,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x20, 0x50, 0x88, 0x04,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xF8, 0x40, 0xA0, 0x10, 0x08,
+    0x03, 0x00, 0x00, 0x01, 0x02,
+    0xF0, 0x80, 0x40, 0x20, 0x10,
+    0x07, 0x00, 0x01, 0x02, 0x04,
+    0xE0, 0x00, 0x80, 0x40, 0x20,
+    0x0F, 0x01, 0x02, 0x04, 0x08,
+    0xC0, 0x00, 0x00, 0x80, 0x40,
+    0x1F, 0x02, 0x05, 0x08, 0x10,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x3F, 0x04, 0x0A, 0x11, 0x20,
+    // 0x4C L
+    0x7F, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x02, 0x02, 0x02, 0x02,
+    0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x04, 0x04, 0x04, 0x04,
+    0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x08, 0x08, 0x08, 0x08,
+    0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x10, 0x10, 0x10, 0x10,
+    0x80, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x20, 0x20, 0x20, 0x20,
+    // 0x4D M
+    0x7F, 0x02, 0x0C, 0x02, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x04, 0x18, 0x04, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x08, 0x30, 0x08, 0xFC,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xF8, 0x10, 0x60, 0x10, 0xF8,
+    0x03, 0x00, 0x00, 0x00, 0x03,
+    0xF0, 0x20, 0xC0, 0x20, 0xF0,
+    0x07, 0x00, 0x00, 0x00, 0x07,
+    0xE0, 0x40, 0x80, 0x40, 0xE0,
+    0x0F, 0x00, 0x01, 0x00, 0x0F,
+    0xC0, 0x80, 0x00, 0x80, 0xC0,
+    0x1F, 0x00, 0x03, 0x00, 0x1F,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x3F, 0x01, 0x06, 0x01, 0x3F,
+    // 0x4E N
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x08, 0x10, 0x20, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x10, 0x20, 0x40, 0xFC,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xF8, 0x20, 0x40, 0x80, 0xF8,
+    0x03, 0x00, 0x00, 0x00, 0x03,
+    0xF0, 0x40, 0x80, 0x00, 0xF0,
+    0x07, 0x00, 0x00, 0x01, 0x07,
+    0xE0, 0x80, 0x00, 0x00, 0xE0,
+    0x0F, 0x00, 0x01, 0x02, 0x0F,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x1F, 0x01, 0x02, 0x04, 0x1F,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x3F, 0x02, 0x04, 0x08, 0x3F,
+    // 0x4F O
+    0x3E, 0x41, 0x41, 0x41, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x82, 0x82, 0x82, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x04, 0x04, 0x04, 0xF8,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xF0, 0x08, 0x08, 0x08, 0xF0,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0xE0, 0x10, 0x10, 0x10, 0xE0,
+    0x03, 0x04, 0x04, 0x04, 0x03,
+    0xC0, 0x20, 0x20, 0x20, 0xC0,
+    0x07, 0x08, 0x08, 0x08, 0x07,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x0F, 0x10, 0x10, 0x10, 0x0F,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x1F, 0x20, 0x20, 0x20, 0x1F,
+    // 0x50 P
+    0x7F, 0x09, 0x09, 0x09, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x12, 0x12, 0x12, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x24, 0x24, 0x24, 0x18,
+    0x01, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x48, 0x48, 0x48, 0x30,
+    0x03, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x90, 0x90, 0x90, 0x60,
+    0x07, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x20, 0x20, 0x20, 0xC0,
+    0x0F, 0x01, 0x01, 0x01, 0x00,
+    0xC0, 0x40, 0x40, 0x40, 0x80,
+    0x1F, 0x02, 0x02, 0x02, 0x01,
+    0x80, 0x80, 0x80, 0x80, 0x00,
+    0x3F, 0x04, 0x04, 0x04, 0x03,
+    // 0x51 Q
+    0x3E, 0x41, 0x51, 0x21, 0x5E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x82, 0xA2, 0x42, 0xBC,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x04, 0x44, 0x84, 0x78,
+    0x00, 0x01, 0x01, 0x00, 0x01,
+    0xF0, 0x08, 0x88, 0x08, 0xF0,
+    0x01, 0x02, 0x02, 0x01, 0x02,
+    0xE0, 0x10, 0x10, 0x10, 0xE0,
+    0x03, 0x04, 0x05, 0x02, 0x05,
+    0xC0, 0x20, 0x20, 0x20, 0xC0,
+    0x07, 0x08, 0x0A, 0x04, 0x0B,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x0F, 0x10, 0x14, 0x08, 0x17,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x1F, 0x20, 0x28, 0x10, 0x2F,
+    // 0x52 R
+    0x7F, 0x09, 0x19, 0x29, 0x46,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x12, 0x32, 0x52, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x24, 0x64, 0xA4, 0x18,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xF8, 0x48, 0xC8, 0x48, 0x30,
+    0x03, 0x00, 0x00, 0x01, 0x02,
+    0xF0, 0x90, 0x90, 0x90, 0x60,
+    0x07, 0x00, 0x01, 0x02, 0x04,
+    0xE0, 0x20, 0x20, 0x20, 0xC0,
+    0x0F, 0x01, 0x03, 0x05, 0x08,
+    0xC0, 0x40, 0x40, 0x40, 0x80,
+    0x1F, 0x02, 0x06, 0x0A, 0x11,
+    0x80, 0x80, 0x80, 0x80, 0x00,
+    0x3F, 0x04, 0x0C, 0x14, 0x23,
+    // 0x53 S
+    0x46, 0x49, 0x49, 0x49, 0x31,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8C, 0x92, 0x92, 0x92, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x24, 0x24, 0x24, 0xC4,
+    0x01, 0x01, 0x01, 0x01, 0x00,
+    0x30, 0x48, 0x48, 0x48, 0x88,
+    0x02, 0x02, 0x02, 0x02, 0x01,
+    0x60, 0x90, 0x90, 0x90, 0x10,
+    0x04, 0x04, 0x04, 0x04, 0x03,
+    0xC0, 0x20, 0x20, 0x20, 0x20,
+    0x08, 0x09, 0x09, 0x09, 0x06,
+    0x80, 0x40, 0x40, 0x40, 0x40,
+    0x11, 0x12, 0x12, 0x12, 0x0C,
+    0x00, 0x80, 0x80, 0x80, 0x80,
+    0x23, 0x24, 0x24, 0x24, 0x18,
+    // 0x54 T
+    0x01, 0x01, 0x7F, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0xFE, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0xFC, 0x04, 0x04,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0x08, 0x08, 0xF8, 0x08, 0x08,
+    0x00, 0x00, 0x03, 0x00, 0x00,
+    0x10, 0x10, 0xF0, 0x10, 0x10,
+    0x00, 0x00, 0x07, 0x00, 0x00,
+    0x20, 0x20, 0xE0, 0x20, 0x20,
+    0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x40, 0x40, 0xC0, 0x40, 0x40,
+    0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x3F, 0x00, 0x00,
+    // 0x55 U
+    0x3F, 0x40, 0x40, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7E, 0x80, 0x80, 0x80, 0x7E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0xFC,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0xF8,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0xF0, 0x00, 0x00, 0x00, 0xF0,
+    0x03, 0x04, 0x04, 0x04, 0x03,
+    0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x07, 0x08, 0x08, 0x08, 0x07,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x0F, 0x10, 0x10, 0x10, 0x0F,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x1F, 0x20, 0x20, 0x20, 0x1F,
+    // 0x56 V
+    0x1F, 0x20, 0x40, 0x20, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x40, 0x80, 0x40, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x80, 0x00, 0x80, 0x7C,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0xF8, 0x00, 0x00, 0x00, 0xF8,
+    0x00, 0x01, 0x02, 0x01, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xF0,
+    0x01, 0x02, 0x04, 0x02, 0x01,
+    0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x03, 0x04, 0x08, 0x04, 0x03,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x07, 0x08, 0x10, 0x08, 0x07,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x0F, 0x10, 0x20, 0x10, 0x0F,
+    // 0x57 W
+    0x3F, 0x40, 0x38, 0x40, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7E, 0x80, 0x70, 0x80, 0x7E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0xE0, 0x00, 0xFC,
+    0x00, 0x01, 0x00, 0x01, 0x00,
+    0xF8, 0x00, 0xC0, 0x00, 0xF8,
+    0x01, 0x02, 0x01, 0x02, 0x01,
+    0xF0, 0x00, 0x80, 0x00, 0xF0,
+    0x03, 0x04, 0x03, 0x04, 0x03,
+    0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x07, 0x08, 0x07, 0x08, 0x07,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x0F, 0x10, 0x0E, 0x10, 0x0F,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x1F, 0x20, 0x1C, 0x20, 0x1F,
+    // 0x58 X
+    0x63, 0x14, 0x08, 0x14, 0x63,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC6, 0x28, 0x10, 0x28, 0xC6,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8C, 0x50, 0x20, 0x50, 0x8C,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0x18, 0xA0, 0x40, 0xA0, 0x18,
+    0x03, 0x00, 0x00, 0x00, 0x03,
+    0x30, 0x40, 0x80, 0x40, 0x30,
+    0x06, 0x01, 0x00, 0x01, 0x06,
+    0x60, 0x80, 0x00, 0x80, 0x60,
+    0x0C, 0x02, 0x01, 0x02, 0x0C,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x18, 0x05, 0x02, 0x05, 0x18,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x31, 0x0A, 0x04, 0x0A, 0x31,
+    // 0x59 Y
+    0x07, 0x08, 0x70, 0x08, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x10, 0xE0, 0x10, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x20, 0xC0, 0x20, 0x1C,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0x38, 0x40, 0x80, 0x40, 0x38,
+    0x00, 0x00, 0x03, 0x00, 0x00,
+    0x70, 0x80, 0x00, 0x80, 0x70,
+    0x00, 0x00, 0x07, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x00, 0x01, 0x0E, 0x01, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x01, 0x02, 0x1C, 0x02, 0x01,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x03, 0x04, 0x38, 0x04, 0x03,
+    // 0x5A Z
+    0x61, 0x51, 0x49, 0x45, 0x43,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC2, 0xA2, 0x92, 0x8A, 0x86,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x44, 0x24, 0x14, 0x0C,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    0x08, 0x88, 0x48, 0x28, 0x18,
+    0x03, 0x02, 0x02, 0x02, 0x02,
+    0x10, 0x10, 0x90, 0x50, 0x30,
+    0x06, 0x05, 0x04, 0x04, 0x04,
+    0x20, 0x20, 0x20, 0xA0, 0x60,
+    0x0C, 0x0A, 0x09, 0x08, 0x08,
+    0x40, 0x40, 0x40, 0x40, 0xC0,
+    0x18, 0x14, 0x12, 0x11, 0x10,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x30, 0x28, 0x24, 0x22, 0x21,
+    // 0x5B [
+    0x00, 0x7F, 0x41, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0x82, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0xF8, 0x08, 0x08, 0x00,
+    0x00, 0x03, 0x02, 0x02, 0x00,
+    0x00, 0xF0, 0x10, 0x10, 0x00,
+    0x00, 0x07, 0x04, 0x04, 0x00,
+    0x00, 0xE0, 0x20, 0x20, 0x00,
+    0x00, 0x0F, 0x08, 0x08, 0x00,
+    0x00, 0xC0, 0x40, 0x40, 0x00,
+    0x00, 0x1F, 0x10, 0x10, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x3F, 0x20, 0x20, 0x00,
+    // 0x5C ?
+    0x02, 0x04, 0x08, 0x10, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x08, 0x10, 0x20, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x10, 0x20, 0x40, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x20, 0x40, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01,
+    0x20, 0x40, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02,
+    0x40, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x04,
+    0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x04, 0x08, 0x10,
+    // 0x5D ]
+    0x00, 0x41, 0x41, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x82, 0x82, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0xFC, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x08, 0x08, 0xF8, 0x00,
+    0x00, 0x02, 0x02, 0x03, 0x00,
+    0x00, 0x10, 0x10, 0xF0, 0x00,
+    0x00, 0x04, 0x04, 0x07, 0x00,
+    0x00, 0x20, 0x20, 0xE0, 0x00,
+    0x00, 0x08, 0x08, 0x0F, 0x00,
+    0x00, 0x40, 0x40, 0xC0, 0x00,
+    0x00, 0x10, 0x10, 0x1F, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x20, 0x20, 0x3F, 0x00,
+    // 0x5E ^
+    0x04, 0x02, 0x01, 0x02, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x04, 0x02, 0x04, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x04, 0x08, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x10, 0x08, 0x10, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x20, 0x10, 0x20, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x40, 0x20, 0x40, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x40, 0x80, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x80, 0x00, 0x00,
+    0x02, 0x01, 0x00, 0x01, 0x02,
+    // 0x5F _
+    0x40, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20,
+    // 0x60 `
+    0x00, 0x01, 0x02, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x04, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x08, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x10, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x20, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x40, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x00,
+    // 0x61 a
+    0x20, 0x54, 0x54, 0x54, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xA8, 0xA8, 0xA8, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x50, 0x50, 0x50, 0xE0,
+    0x00, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0xA0, 0xA0, 0xA0, 0xC0,
+    0x01, 0x02, 0x02, 0x02, 0x03,
+    0x00, 0x40, 0x40, 0x40, 0x80,
+    0x02, 0x05, 0x05, 0x05, 0x07,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x04, 0x0A, 0x0A, 0x0A, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x15, 0x15, 0x15, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x2A, 0x2A, 0x2A, 0x3C,
+    // 0x62 b
+    0x7F, 0x48, 0x44, 0x44, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x90, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x20, 0x10, 0x10, 0xE0,
+    0x01, 0x01, 0x01, 0x01, 0x00,
+    0xF8, 0x40, 0x20, 0x20, 0xC0,
+    0x03, 0x02, 0x02, 0x02, 0x01,
+    0xF0, 0x80, 0x40, 0x40, 0x80,
+    0x07, 0x04, 0x04, 0x04, 0x03,
+    0xE0, 0x00, 0x80, 0x80, 0x00,
+    0x0F, 0x09, 0x08, 0x08, 0x07,
+    0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x12, 0x11, 0x11, 0x0E,
+    0x80, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x24, 0x22, 0x22, 0x1C,
+    // 0x63 c
+    0x38, 0x44, 0x44, 0x44, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x88, 0x88, 0x88, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x10, 0x10, 0x10, 0x80,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xC0, 0x20, 0x20, 0x20, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0x80, 0x40, 0x40, 0x40, 0x00,
+    0x03, 0x04, 0x04, 0x04, 0x02,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x07, 0x08, 0x08, 0x08, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x11, 0x11, 0x11, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x22, 0x22, 0x22, 0x10,
+    // 0x64 d
+    0x38, 0x44, 0x44, 0x48, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x88, 0x88, 0x90, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x10, 0x10, 0x20, 0xFC,
+    0x00, 0x01, 0x01, 0x01, 0x01,
+    0xC0, 0x20, 0x20, 0x40, 0xF8,
+    0x01, 0x02, 0x02, 0x02, 0x03,
+    0x80, 0x40, 0x40, 0x80, 0xF0,
+    0x03, 0x04, 0x04, 0x04, 0x07,
+    0x00, 0x80, 0x80, 0x00, 0xE0,
+    0x07, 0x08, 0x08, 0x09, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x0E, 0x11, 0x11, 0x12, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x80,
+    0x1C, 0x22, 0x22, 0x24, 0x3F,
+    // 0x65 e
+    0x38, 0x54, 0x54, 0x54, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xA8, 0xA8, 0xA8, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x50, 0x50, 0x50, 0x60,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xC0, 0xA0, 0xA0, 0xA0, 0xC0,
+    0x01, 0x02, 0x02, 0x02, 0x00,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x03, 0x05, 0x05, 0x05, 0x01,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x07, 0x0A, 0x0A, 0x0A, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x15, 0x15, 0x15, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x2A, 0x2A, 0x2A, 0x0C,
+    // 0x66 f
+    0x08, 0x7E, 0x09, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0x12, 0x02, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xF8, 0x24, 0x04, 0x08,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+    0x40, 0xF0, 0x48, 0x08, 0x10,
+    0x00, 0x03, 0x00, 0x00, 0x00,
+    0x80, 0xE0, 0x90, 0x10, 0x20,
+    0x00, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x20, 0x20, 0x40,
+    0x01, 0x0F, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x40, 0x40, 0x80,
+    0x02, 0x1F, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0x00,
+    0x04, 0x3F, 0x04, 0x00, 0x01,
+    // 0x67 g
+    0x0C, 0x52, 0x52, 0x52, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xA4, 0xA4, 0xA4, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x48, 0x48, 0x48, 0xF8,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x60, 0x90, 0x90, 0x90, 0xF0,
+    0x00, 0x02, 0x02, 0x02, 0x01,
+    0xC0, 0x20, 0x20, 0x20, 0xE0,
+    0x00, 0x05, 0x05, 0x05, 0x03,
+    0x80, 0x40, 0x40, 0x40, 0xC0,
+    0x01, 0x0A, 0x0A, 0x0A, 0x07,
+    0x00, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x14, 0x14, 0x14, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x29, 0x29, 0x29, 0x1F,
+    // 0x68 h
+    0x7F, 0x08, 0x04, 0x04, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x10, 0x08, 0x08, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x20, 0x10, 0x10, 0xE0,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xF8, 0x40, 0x20, 0x20, 0xC0,
+    0x03, 0x00, 0x00, 0x00, 0x03,
+    0xF0, 0x80, 0x40, 0x40, 0x80,
+    0x07, 0x00, 0x00, 0x00, 0x07,
+    0xE0, 0x00, 0x80, 0x80, 0x00,
+    0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x02, 0x01, 0x01, 0x1E,
+    0x80, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x04, 0x02, 0x02, 0x3C,
+    // 0x69 i
+    0x00, 0x44, 0x7D, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0xFA, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xF4, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x20, 0xE8, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x02, 0x00,
+    0x00, 0x40, 0xD0, 0x00, 0x00,
+    0x00, 0x04, 0x07, 0x04, 0x00,
+    0x00, 0x80, 0xA0, 0x00, 0x00,
+    0x00, 0x08, 0x0F, 0x08, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x11, 0x1F, 0x10, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x22, 0x3E, 0x20, 0x00,
+    // 0x6A j
+    0x20, 0x40, 0x44, 0x3D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x80, 0x88, 0x7A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x10, 0xF4, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xE8, 0x00,
+    0x01, 0x02, 0x02, 0x01, 0x00,
+    0x00, 0x00, 0x40, 0xD0, 0x00,
+    0x02, 0x04, 0x04, 0x03, 0x00,
+    0x00, 0x00, 0x80, 0xA0, 0x00,
+    0x04, 0x08, 0x08, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00,
+    0x08, 0x10, 0x11, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00,
+    0x10, 0x20, 0x22, 0x1E, 0x00,
+    // 0x6B k
+    0x7F, 0x10, 0x28, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x20, 0x50, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x40, 0xA0, 0x10, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00,
+    0xF8, 0x80, 0x40, 0x20, 0x00,
+    0x03, 0x00, 0x01, 0x02, 0x00,
+    0xF0, 0x00, 0x80, 0x40, 0x00,
+    0x07, 0x01, 0x02, 0x04, 0x00,
+    0xE0, 0x00, 0x00, 0x80, 0x00,
+    0x0F, 0x02, 0x05, 0x08, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x04, 0x0A, 0x11, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0x08, 0x14, 0x22, 0x00,
+    // 0x6C l
+    0x00, 0x41, 0x7F, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x82, 0xFE, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFC, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x08, 0xF8, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x02, 0x00,
+    0x00, 0x10, 0xF0, 0x00, 0x00,
+    0x00, 0x04, 0x07, 0x04, 0x00,
+    0x00, 0x20, 0xE0, 0x00, 0x00,
+    0x00, 0x08, 0x0F, 0x08, 0x00,
+    0x00, 0x40, 0xC0, 0x00, 0x00,
+    0x00, 0x10, 0x1F, 0x10, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x20, 0x3F, 0x20, 0x00,
+    // 0x6D m
+    0x7C, 0x04, 0x18, 0x04, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x08, 0x30, 0x08, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x10, 0x60, 0x10, 0xE0,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xE0, 0x20, 0xC0, 0x20, 0xC0,
+    0x03, 0x00, 0x00, 0x00, 0x03,
+    0xC0, 0x40, 0x80, 0x40, 0x80,
+    0x07, 0x00, 0x01, 0x00, 0x07,
+    0x80, 0x80, 0x00, 0x80, 0x00,
+    0x0F, 0x00, 0x03, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x01, 0x06, 0x01, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x02, 0x0C, 0x02, 0x3C,
+    // 0x6E n
+    0x7C, 0x08, 0x04, 0x04, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x10, 0x08, 0x08, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x20, 0x10, 0x10, 0xE0,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0xE0, 0x40, 0x20, 0x20, 0xC0,
+    0x03, 0x00, 0x00, 0x00, 0x03,
+    0xC0, 0x80, 0x40, 0x40, 0x80,
+    0x07, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x80, 0x80, 0x00,
+    0x0F, 0x01, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x02, 0x01, 0x01, 0x1E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x04, 0x02, 0x02, 0x3C,
+    // 0x6F o
+    0x38, 0x44, 0x44, 0x44, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x10, 0x10, 0x10, 0xE0,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0xC0, 0x20, 0x20, 0x20, 0xC0,
+    0x01, 0x02, 0x02, 0x02, 0x01,
+    0x80, 0x40, 0x40, 0x40, 0x80,
+    0x03, 0x04, 0x04, 0x04, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x07, 0x08, 0x08, 0x08, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x11, 0x11, 0x11, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x22, 0x22, 0x22, 0x1C,
+    // 0x70 p
+    0x7C, 0x14, 0x14, 0x14, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x28, 0x28, 0x28, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x50, 0x50, 0x50, 0x20,
+    0x01, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xA0, 0xA0, 0xA0, 0x40,
+    0x03, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x40, 0x40, 0x40, 0x80,
+    0x07, 0x01, 0x01, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x00,
+    0x0F, 0x02, 0x02, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x05, 0x05, 0x05, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x0A, 0x0A, 0x0A, 0x04,
+    // 0x71 q
+    0x08, 0x14, 0x14, 0x18, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x28, 0x28, 0x30, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x50, 0x50, 0x60, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x01,
+    0x40, 0xA0, 0xA0, 0xC0, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x03,
+    0x80, 0x40, 0x40, 0x80, 0xC0,
+    0x00, 0x01, 0x01, 0x01, 0x07,
+    0x00, 0x80, 0x80, 0x00, 0x80,
+    0x01, 0x02, 0x02, 0x03, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x05, 0x05, 0x06, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x0A, 0x0A, 0x0C, 0x3E,
+    // 0x72 r
+    0x7C, 0x08, 0x04, 0x04, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x10, 0x08, 0x08, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x20, 0x10, 0x10, 0x20,
+    0x01, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x40, 0x20, 0x20, 0x40,
+    0x03, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0x80, 0x40, 0x40, 0x80,
+    0x07, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x00, 0x80, 0x80, 0x00,
+    0x0F, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x02, 0x01, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x04, 0x02, 0x02, 0x04,
+    // 0x73 s
+    0x48, 0x54, 0x54, 0x54, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xA8, 0xA8, 0xA8, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x50, 0x50, 0x50, 0x80,
+    0x01, 0x01, 0x01, 0x01, 0x00,
+    0x40, 0xA0, 0xA0, 0xA0, 0x00,
+    0x02, 0x02, 0x02, 0x02, 0x01,
+    0x80, 0x40, 0x40, 0x40, 0x00,
+    0x04, 0x05, 0x05, 0x05, 0x02,
+    0x00, 0x80, 0x80, 0x80, 0x00,
+    0x09, 0x0A, 0x0A, 0x0A, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0x15, 0x15, 0x15, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x24, 0x2A, 0x2A, 0x2A, 0x10,
+    // 0x74 t
+    0x04, 0x3F, 0x44, 0x40, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x7E, 0x88, 0x80, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFC, 0x10, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x01, 0x00,
+    0x20, 0xF8, 0x20, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x01,
+    0x40, 0xF0, 0x40, 0x00, 0x00,
+    0x00, 0x03, 0x04, 0x04, 0x02,
+    0x80, 0xE0, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x08, 0x08, 0x04,
+    0x00, 0xC0, 0x00, 0x00, 0x00,
+    0x01, 0x0F, 0x11, 0x10, 0x08,
+    0x00, 0x80, 0x00, 0x00, 0x00,
+    0x02, 0x1F, 0x22, 0x20, 0x10,
+    // 0x75 u
+    0x3C, 0x40, 0x40, 0x20, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x80, 0x80, 0x40, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x80, 0xF0,
+    0x00, 0x01, 0x01, 0x00, 0x01,
+    0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x01, 0x02, 0x02, 0x01, 0x03,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x03, 0x04, 0x04, 0x02, 0x07,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x07, 0x08, 0x08, 0x04, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x10, 0x10, 0x08, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x20, 0x20, 0x10, 0x3E,
+    // 0x76 v
+    0x1C, 0x20, 0x40, 0x20, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x40, 0x80, 0x40, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x80, 0x00, 0x80, 0x70,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x00, 0xE0,
+    0x00, 0x01, 0x02, 0x01, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x01, 0x02, 0x04, 0x02, 0x01,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x03, 0x04, 0x08, 0x04, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x08, 0x10, 0x08, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x10, 0x20, 0x10, 0x0E,
+    // 0x77 w
+    0x3C, 0x40, 0x30, 0x40, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x80, 0x60, 0x80, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0xC0, 0x00, 0xF0,
+    0x00, 0x01, 0x00, 0x01, 0x00,
+    0xE0, 0x00, 0x80, 0x00, 0xE0,
+    0x01, 0x02, 0x01, 0x02, 0x01,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x03, 0x04, 0x03, 0x04, 0x03,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x07, 0x08, 0x06, 0x08, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x10, 0x0C, 0x10, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x20, 0x18, 0x20, 0x1E,
+    // 0x78 x
+    0x44, 0x28, 0x10, 0x28, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x50, 0x20, 0x50, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xA0, 0x40, 0xA0, 0x10,
+    0x01, 0x00, 0x00, 0x00, 0x01,
+    0x20, 0x40, 0x80, 0x40, 0x20,
+    0x02, 0x01, 0x00, 0x01, 0x02,
+    0x40, 0x80, 0x00, 0x80, 0x40,
+    0x04, 0x02, 0x01, 0x02, 0x04,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x08, 0x05, 0x02, 0x05, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x0A, 0x04, 0x0A, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x14, 0x08, 0x14, 0x22,
+    // 0x79 y
+    0x0C, 0x50, 0x50, 0x50, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xA0, 0xA0, 0xA0, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x40, 0x40, 0x40, 0xF0,
+    0x00, 0x01, 0x01, 0x01, 0x00,
+    0x60, 0x80, 0x80, 0x80, 0xE0,
+    0x00, 0x02, 0x02, 0x02, 0x01,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x00, 0x05, 0x05, 0x05, 0x03,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x0A, 0x0A, 0x0A, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x14, 0x14, 0x14, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x28, 0x28, 0x28, 0x1E,
+    // 0x7A z
+    0x44, 0x64, 0x54, 0x4C, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0xC8, 0xA8, 0x98, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x90, 0x50, 0x30, 0x10,
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    0x20, 0x20, 0xA0, 0x60, 0x20,
+    0x02, 0x03, 0x02, 0x02, 0x02,
+    0x40, 0x40, 0x40, 0xC0, 0x40,
+    0x04, 0x06, 0x05, 0x04, 0x04,
+    0x80, 0x80, 0x80, 0x80, 0x80,
+    0x08, 0x0C, 0x0A, 0x09, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x19, 0x15, 0x13, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x32, 0x2A, 0x26, 0x22,
+    // 0x7B {
+    0x00, 0x08, 0x36, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x6C, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xD8, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x40, 0xB0, 0x08, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0x80, 0x60, 0x10, 0x00,
+    0x00, 0x00, 0x03, 0x04, 0x00,
+    0x00, 0x00, 0xC0, 0x20, 0x00,
+    0x00, 0x01, 0x06, 0x08, 0x00,
+    0x00, 0x00, 0x80, 0x40, 0x00,
+    0x00, 0x02, 0x0D, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x04, 0x1B, 0x20, 0x00,
+    // 0x7C |
+    0x00, 0x00, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0x00, 0x00,
+    // 0x7D }
+    0x00, 0x41, 0x36, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x82, 0x6C, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xD8, 0x20, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xB0, 0x40, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x00,
+    0x00, 0x10, 0x60, 0x80, 0x00,
+    0x00, 0x04, 0x03, 0x00, 0x00,
+    0x00, 0x20, 0xC0, 0x00, 0x00,
+    0x00, 0x08, 0x06, 0x01, 0x00,
+    0x00, 0x40, 0x80, 0x00, 0x00,
+    0x00, 0x10, 0x0D, 0x02, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x1B, 0x04, 0x00,
+    // 0x7E ~
+    0x10, 0x08, 0x08, 0x10, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x10, 0x10, 0x20, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x20, 0x20, 0x40, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x40, 0x40, 0x80, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x01, 0x01, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x02, 0x02, 0x04, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x04, 0x04, 0x08, 0x04,
+    // 0x7F UT sign
+    0x1F, 0x24, 0x7C, 0x24, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x48, 0xF8, 0x48, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x90, 0xF0, 0x90, 0x7C,
+    0x00, 0x00, 0x01, 0x00, 0x00,
+    0xF8, 0x20, 0xE0, 0x20, 0xF8,
+    0x00, 0x01, 0x03, 0x01, 0x00,
+    0xF0, 0x40, 0xC0, 0x40, 0xF0,
+    0x01, 0x02, 0x07, 0x02, 0x01,
+    0xE0, 0x80, 0x80, 0x80, 0xE0,
+    0x03, 0x04, 0x0F, 0x04, 0x03,
+    0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0x07, 0x09, 0x1F, 0x09, 0x07,
+    0x80, 0x00, 0x00, 0x00, 0x80,
+    0x0F, 0x12, 0x3E, 0x12, 0x0F,
+};
+
+static const Font font5x8 = {
+    8, 5, 2, 2, 0x20, 96,
+    font5x8Index, font5x8Width, font5x8Glyphs
+};
+
+#endif // FONT_5X8_H
@@ -0,0 +1,153 @@
+#ifndef FPU_H
+#define FPU_H
+
+#include "TM4C123.h"
+#include <stdint.h>
+#include "clock.h"
+#include "printHelper.h"
+
+// ==================== Floating-Point Unit ====================
+// The target is built for the Cortex-M4F FPv4-SP unit with the hard-float
+// ABI (uvprojx: Floating Point Hardware "Single Precision", which AC6 turns
+// into -mfpu=fpv4-sp-d16 -mfloat-abi=hard). The FPU only does single
+// precision: any double (a 0.1 literal, float promoted by a double constant)
+// still goes through the software library, so firmware code sticks to
+// float and 'f' literals. -Wdouble-promotion flags the slips.
+//
+// Fpu_Init grants CP10/CP11 access (SystemInit does too; this does not rely
+// on it) and turns on automatic plus lazy state preservation: an ISR that
+// never touches the FPU pays nothing for it, and one that does only pays
+// for stacking s0-s15/FPSCR when it issues its first FP instruction.
+// kernel_switch.s saves s16-s31 only for tasks with an active FP context.
+
+#ifndef FPU_BENCH_ENABLED
+#define FPU_BENCH_ENABLED 0
+#endif
+
+// Function prototypes
+void Fpu_Init(void);
+
+// Enable the FPU with automatic, lazy context stacking
+void Fpu_Init(void) {
+#if (__FPU_USED == 1)
+    SCB->CPACR |= (3UL << 10 * 2) | (3UL << 11 * 2);         // Full access to CP10 and CP11
+    FPU->FPCCR |= FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk; // Stack FP state on exception entry, lazily
+    __DSB();
+    __ISB();                                                 // FP instructions usable from here
+#endif
+}
+
+// ==================== FPU Benchmark ====================
+// With FPU_BENCH_ENABLED the float paths of the application are run
+// FPU_BENCH_LOOPS times twice: once as the firmware now computes them and
+// once as the code did before the single-precision cleanup. Average cycles
+// per pass, less the loop overhead, are printed over UART0:
+//
+//   bmp280   - compensated reading to Celsius: / 100.0f, was / 100.0
+//              (double library calls)
+//   echo     - pulse width to cm: integer, was pulseWidth times a double
+//              constant (double library calls)
+//   tone     - alert tone from the average temperature: * 50.0f, was
+//              500 * (avg / 10) (both float; the divide is saved)
+//   average  - sampleSum / FILTER_SIZE after FILTER_SIZE additions; float
+//              before and after, shown for scale only
+//
+// Building with Floating Point Hardware "Not Used" and running it again
+// gives the soft-float numbers.
+
+#if FPU_BENCH_ENABLED
+
+#define FPU_BENCH_LOOPS   64
+#define FPU_BENCH_SAMPLES 128          // FILTER_SIZE
+
+void Fpu_Bench(void);
+
+static void Fpu_BenchPrint(const char *name, uint32_t now, uint32_t before, uint32_t overhead) {
+    printString(name);
+    printString(": now ");
+    printInt(now > overhead ? (now - overhead) / FPU_BENCH_LOOPS : 0);
+    printString(", before ");
+    printInt(before > overhead ? (before - overhead) / FPU_BENCH_LOOPS : 0);
+    printString(" cycles\r\n");
+}
+
+// Measure every path once at startup
+void Fpu_Bench(void) {
+    static volatile float samples[FPU_BENCH_SAMPLES];
+    static volatile float sinkF;
+    static volatile uint32_t sinkU;
+    volatile int32_t rawCentiC = 2345;
+    volatile uint32_t pulseWidth = 583 * Clock_TicksPerUs();   // About 10 cm
+    volatile double echoScale = 0.01715 / Clock_TicksPerUs();  // cm per tick, as the old constant
+    volatile float temperature = 23.45f;
+    uint32_t start, overhead, now, before;
+
+    for (int i = 0; i < FPU_BENCH_SAMPLES; i++) {
+        samples[i] = 20.0f + i * 0.01f;
+    }
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < FPU_BENCH_LOOPS; i++) {
+        __NOP();
+    }
+    overhead = DWT->CYCCNT - start;
+
+    printString("FPU bench (");
+    printString(__FPU_USED == 1 ? "hard" : "soft");
+    printString(" float)\r\n");
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < FPU_BENCH_LOOPS; i++) {
+        float temp = rawCentiC;
+        sinkF = temp / 100.0f;
+    }
+    now = DWT->CYCCNT - start;
+    start = DWT->CYCCNT;
+    for (int i = 0; i < FPU_BENCH_LOOPS; i++) {
+        float temp = rawCentiC;
+        sinkF = (float)((double)temp / 100.0);   // The old promotion, spelled out
+    }
+    before = DWT->CYCCNT - start;
+    Fpu_BenchPrint("bmp280", now, before, overhead);
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < FPU_BENCH_LOOPS; i++) {
+        sinkU = (pulseWidth / Clock_TicksPerUs()) * 343 / 20000;
+    }
+    now = DWT->CYCCNT - start;
+    start = DWT->CYCCNT;
+    for (int i = 0; i < FPU_BENCH_LOOPS; i++) {
+        sinkU = pulseWidth * echoScale;
+    }
+    before = DWT->CYCCNT - start;
+    Fpu_BenchPrint("echo", now, before, overhead);
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < FPU_BENCH_LOOPS; i++) {
+        sinkU = (uint32_t)(temperature * 50.0f);
+    }
+    now = DWT->CYCCNT - start;
+    start = DWT->CYCCNT;
+    for (int i = 0; i < FPU_BENCH_LOOPS; i++) {
+        sinkU = 500 * (temperature / 10);
+    }
+    before = DWT->CYCCNT - start;
+    Fpu_BenchPrint("tone", now, before, overhead);
+
+    start = DWT->CYCCNT;
+    for (int i = 0; i < FPU_BENCH_LOOPS; i++) {
+        float sum = 0.0f;
+        for (int j = 0; j < FPU_BENCH_SAMPLES; j++) sum += samples[j];
+        sinkF = sum / FPU_BENCH_SAMPLES;
+    }
+    now = DWT->CYCCNT - start;
+    Fpu_BenchPrint("average", now, now, overhead);
+}
+
+#else
+
+#define Fpu_Bench() ((void)0)
+
+#endif // FPU_BENCH_ENABLED
+
+#endif // FPU_H
@@ -0,0 +1,241 @@
+#ifndef GFX_H
+#define GFX_H
+
+#include <stdint.h>
+#include "Nokia5110.h"
+
+// ==================== Framebuffer Graphics ====================
+// Integer-only drawing into the Nokia5110 Screen buffer. Screen is six banks
+// of 84 column bytes; bit n of a byte is pixel row 8 * bank + n. Lines and
+// fills are done as byte-mask operations (a vertical run inside one bank is a
+// single read-modify-write), everything is clipped to the 84x48 screen, and
+// each call marks its bounding box dirty once instead of per pixel.
+// Coordinates are x = column (0 left), y = row (0 top); angles are degrees
+// clockwise from straight up, as the scan sees them (-90 left, +90 right).
+//
+// Draw from one context (the app task) between Lcd_BeginFrame() and
+// Lcd_ShowFrame().
+
+#define GFX_WIDTH  84
+#define GFX_HEIGHT 48
+#define GFX_BANKS  (GFX_HEIGHT / 8)
+
+#define GFX_CLEAR  0
+#define GFX_SET    1
+#define GFX_INVERT 2
+
+#define GFX_ONE    16384               // 1.0 in the Q14 sine table
+
+// sin(0..90 degrees) in Q14
+static const int16_t gfxSin[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+// Function prototypes
+int32_t Gfx_Sin(int32_t deg);
+int32_t Gfx_Cos(int32_t deg);
+void Gfx_Pixel(int32_t x, int32_t y, uint8_t color);
+void Gfx_HLine(int32_t x0, int32_t x1, int32_t y, uint8_t color);
+void Gfx_VLine(int32_t x, int32_t y0, int32_t y1, uint8_t color);
+void Gfx_FillRect(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t color);
+void Gfx_Line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t color);
+void Gfx_PolarPoint(int32_t ox, int32_t oy, int32_t deg, int32_t r, int32_t *x, int32_t *y);
+void Gfx_Ray(int32_t ox, int32_t oy, int32_t deg, int32_t r0, int32_t r1, uint8_t color);
+void Gfx_Arc(int32_t cx, int32_t cy, int32_t r, int32_t fromDeg, int32_t toDeg, uint8_t color);
+
+// sin(deg) in Q14, any integer angle
+int32_t Gfx_Sin(int32_t deg) {
+    deg %= 360;
+    if (deg < 0) deg += 360;
+    if (deg <= 90)  return gfxSin[deg];
+    if (deg <= 180) return gfxSin[180 - deg];
+    if (deg <= 270) return -gfxSin[deg - 180];
+    return -gfxSin[360 - deg];
+}
+
+// cos(deg) in Q14
+int32_t Gfx_Cos(int32_t deg) {
+    return Gfx_Sin(deg + 90);
+}
+
+// Apply color to the bits of mask in one Screen byte
+static inline void Gfx_Apply(uint8_t *p, uint8_t mask, uint8_t color) {
+    if (color == GFX_SET) {
+        *p |= mask;
+    } else if (color == GFX_CLEAR) {
+        *p &= ~mask;
+    } else {
+        *p ^= mask;
+    }
+}
+
+// Pixel rows y0..y1 (both in bank) as a byte mask
+static inline uint8_t Gfx_BankMask(int32_t y0, int32_t y1) {
+    return (uint8_t)((0xFFu << (y0 & 7)) & (0xFFu >> (7 - (y1 & 7))));
+}
+
+static inline int32_t Gfx_Clamp(int32_t v, int32_t lo, int32_t hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// Mark the on-screen part of a box dirty, once per bank
+static void Gfx_MarkDirty(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    if (x1 < 0 || y1 < 0 || x0 >= GFX_WIDTH || y0 >= GFX_HEIGHT) return;
+    x0 = Gfx_Clamp(x0, 0, GFX_WIDTH - 1);
+    x1 = Gfx_Clamp(x1, 0, GFX_WIDTH - 1);
+    y0 = Gfx_Clamp(y0, 0, GFX_HEIGHT - 1);
+    y1 = Gfx_Clamp(y1, 0, GFX_HEIGHT - 1);
+    for (int32_t bank = y0 >> 3; bank <= (y1 >> 3); bank++) {
+        Nokia5110_MarkDirty(bank, x0, x1);
+    }
+}
+
+// Plot without marking (callers mark their bounding box)
+static inline void Gfx_Plot(int32_t x, int32_t y, uint8_t color) {
+    if ((uint32_t)x < GFX_WIDTH && (uint32_t)y < GFX_HEIGHT) {
+        Gfx_Apply(&Screen[GFX_WIDTH * (y >> 3) + x], (uint8_t)(1u << (y & 7)), color);
+    }
+}
+
+// One pixel
+void Gfx_Pixel(int32_t x, int32_t y, uint8_t color) {
+    Gfx_Plot(x, y, color);
+    Gfx_MarkDirty(x, y, x, y);
+}
+
+// Horizontal line from x0 to x1 (either order) on row y
+void Gfx_HLine(int32_t x0, int32_t x1, int32_t y, uint8_t color) {
+    if (x0 > x1) { int32_t t = x0; x0 = x1; x1 = t; }
+    if ((uint32_t)y >= GFX_HEIGHT || x1 < 0 || x0 >= GFX_WIDTH) return;
+    x0 = Gfx_Clamp(x0, 0, GFX_WIDTH - 1);
+    x1 = Gfx_Clamp(x1, 0, GFX_WIDTH - 1);
+
+    uint8_t *p = &Screen[GFX_WIDTH * (y >> 3) + x0];
+    uint8_t mask = (uint8_t)(1u << (y & 7));
+    for (int32_t x = x0; x <= x1; x++) {
+        Gfx_Apply(p++, mask, color);
+    }
+    Nokia5110_MarkDirty(y >> 3, x0, x1);
+}
+
+// Vertical line from y0 to y1 (either order) in column x: one byte per bank
+void Gfx_VLine(int32_t x, int32_t y0, int32_t y1, uint8_t color) {
+    Gfx_FillRect(x, y0, x, y1, color);
+}
+
+// Filled rectangle between two corners (inclusive, either order)
+void Gfx_FillRect(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t color) {
+    if (x0 > x1) { int32_t t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { int32_t t = y0; y0 = y1; y1 = t; }
+    if (x1 < 0 || y1 < 0 || x0 >= GFX_WIDTH || y0 >= GFX_HEIGHT) return;
+    x0 = Gfx_Clamp(x0, 0, GFX_WIDTH - 1);
+    x1 = Gfx_Clamp(x1, 0, GFX_WIDTH - 1);
+    y0 = Gfx_Clamp(y0, 0, GFX_HEIGHT - 1);
+    y1 = Gfx_Clamp(y1, 0, GFX_HEIGHT - 1);
+
+    for (int32_t bank = y0 >> 3; bank <= (y1 >> 3); bank++) {
+        int32_t top = (y0 > bank * 8) ? y0 : bank * 8;
+        int32_t bottom = (y1 < bank * 8 + 7) ? y1 : bank * 8 + 7;
+        uint8_t mask = Gfx_BankMask(top, bottom);
+        uint8_t *p = &Screen[GFX_WIDTH * bank + x0];
+        for (int32_t x = x0; x <= x1; x++) {
+            Gfx_Apply(p++, mask, color);
+        }
+        Nokia5110_MarkDirty(bank, x0, x1);
+    }
+}
+
+// Bresenham line between two points (inclusive); off-screen parts are skipped
+void Gfx_Line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t color) {
+    if (y0 == y1) {
+        Gfx_HLine(x0, x1, y0, color);
+        return;
+    }
+    if (x0 == x1) {
+        Gfx_VLine(x0, y0, y1, color);
+        return;
+    }
+    int32_t minX = x0 < x1 ? x0 : x1, maxX = x0 < x1 ? x1 : x0;
+    int32_t minY = y0 < y1 ? y0 : y1, maxY = y0 < y1 ? y1 : y0;
+    if (maxX < 0 || maxY < 0 || minX >= GFX_WIDTH || minY >= GFX_HEIGHT) return;
+
+    int32_t dx = x1 - x0, dy = y1 - y0;
+    int32_t sx = dx > 0 ? 1 : -1, sy = dy > 0 ? 1 : -1;
+    dx = dx * sx;
+    dy = -dy * sy;
+    int32_t err = dx + dy;
+
+    while (1) {
+        Gfx_Plot(x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+    Gfx_MarkDirty(minX, minY, maxX, maxY);
+}
+
+// Point r pixels from (ox, oy) in direction deg
+void Gfx_PolarPoint(int32_t ox, int32_t oy, int32_t deg, int32_t r, int32_t *x, int32_t *y) {
+    *x = ox + ((r * Gfx_Sin(deg) + GFX_ONE / 2) >> 14);   // Rounded (arithmetic shift)
+    *y = oy - ((r * Gfx_Cos(deg) + GFX_ONE / 2) >> 14);
+}
+
+// Ray from radius r0 to r1 out of (ox, oy) in direction deg
+void Gfx_Ray(int32_t ox, int32_t oy, int32_t deg, int32_t r0, int32_t r1, uint8_t color) {
+    int32_t x0, y0, x1, y1;
+    Gfx_PolarPoint(ox, oy, deg, r0, &x0, &y0);
+    Gfx_PolarPoint(ox, oy, deg, r1, &x1, &y1);
+    Gfx_Line(x0, y0, x1, y1, color);
+}
+
+// Nonzero if offset (dx, dy) lies clockwise from fromDeg up to toDeg
+static int Gfx_InSector(int32_t dx, int32_t dy, int32_t fromDeg, int32_t toDeg) {
+    int32_t span = toDeg - fromDeg;
+    if (span >= 360) return 1;
+    int32_t sx = Gfx_Sin(fromDeg), sy = -Gfx_Cos(fromDeg);
+    int32_t ex = Gfx_Sin(toDeg), ey = -Gfx_Cos(toDeg);
+    int32_t afterStart = sx * dy - sy * dx >= 0;   // Cross products: clockwise of start,
+    int32_t beforeEnd = dx * ey - dy * ex >= 0;    // counterclockwise of end
+    return (span <= 180) ? (afterStart && beforeEnd) : (afterStart || beforeEnd);
+}
+
+// Arc of radius r around (cx, cy) from fromDeg clockwise to toDeg (midpoint
+// circle; fromDeg 0, toDeg 360 is a full circle). The octants share their
+// end pixels, so GFX_INVERT draws as GFX_SET here.
+void Gfx_Arc(int32_t cx, int32_t cy, int32_t r, int32_t fromDeg, int32_t toDeg, uint8_t color) {
+    if (r <= 0) {
+        Gfx_Pixel(cx, cy, color);
+        return;
+    }
+    int32_t x = r, y = 0, err = 1 - r;
+
+    while (x >= y) {
+        const int32_t px[8] = {  x,  y, -y, -x, -x, -y,  y,  x };
+        const int32_t py[8] = {  y,  x,  x,  y, -y, -x, -x, -y };
+        for (int i = 0; i < 8; i++) {
+            if (Gfx_InSector(px[i], py[i], fromDeg, toDeg)) {
+                Gfx_Plot(cx + px[i], cy + py[i], color == GFX_INVERT ? GFX_SET : color);
+            }
+        }
+        y++;
+        if (err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+    Gfx_MarkDirty(cx - r, cy - r, cx + r, cy + r);
+}
+
+#endif // GFX_H
@@ -0,0 +1,176 @@
+#ifndef IRQ_PRIORITY_H
+#define IRQ_PRIORITY_H
+
+#include "tm4c123gh6pm.h"
+#include "TM4C123.h"
+#include <stdint.h>
+#include "printHelper.h"
+#include "soft_timer.h"
+#include "DistanceSensor.h"
+#include "isr_stats.h"
+
+// ==================== Interrupt Priority Plan ====================
+// Every NVIC priority in the system is set here, in one table. The TM4C123
+// implements 3 priority bits: 0 is the most urgent, 7 the least.
+//
+//   0  WTIMER0A  echo capture   - must pair rising/falling edges on time;
+//                                 above the BASEPRI level, never masked
+//   1  WTIMER0B  echo notify    - software-pended, posts to the ranging task
+//   1  WTIMER1A  timebase wrap  - a few instructions, keeps time monotonic
+//   2  TIMER4A   soft timers    - short callbacks that post events
+//   3  COMP0     wake           - one-off
+//   4  I2C0      BMP280
+//   5  UART0     TX FIFO refill - a 16-byte FIFO covers the latency
+//   5  SSI0      LCD flush      - one step per span; a late step only delays the LCD
+//   6  GPIOE     push buttons   - UI, queues presses for the main loop
+//   7  SysTick   kernel tick    - must not preempt a handler (kernel.h)
+//   7  PendSV    context switch - runs once every handler has returned
+//
+// Anything that logs or touches the LCD belongs at the bottom so it can be
+// preempted by capture and timekeeping.
+
+typedef struct {
+    IRQn_Type irq;
+    uint8_t priority;
+} IrqPriority;
+
+static const IrqPriority irqPriorityTable[] = {
+    { WTIMER0A_IRQn, 0 },
+    { WTIMER0B_IRQn, 1 },
+    { WTIMER1A_IRQn, 1 },
+    { TIMER4A_IRQn,  2 },
+    { COMP0_IRQn,    3 },
+    { I2C0_IRQn,     4 },
+    { UART0_IRQn,    5 },
+    { SSI0_IRQn,     5 },
+    { GPIOE_IRQn,    6 },
+    { SysTick_IRQn,  7 },
+    { PendSV_IRQn,   7 },
+};
+
+#define IRQ_PRIORITY_COUNT (sizeof(irqPriorityTable) / sizeof(irqPriorityTable[0]))
+
+// Function prototypes
+void IrqPriority_Init(void);
+void IrqPriority_Flat(void);
+
+// Apply the priority plan
+void IrqPriority_Init(void) {
+    for (uint32_t i = 0; i < IRQ_PRIORITY_COUNT; i++) {
+        NVIC_SetPriority(irqPriorityTable[i].irq, irqPriorityTable[i].priority);
+    }
+}
+
+// Put every IRQ in the table back at the reset priority (0), as before the plan
+void IrqPriority_Flat(void) {
+    for (uint32_t i = 0; i < IRQ_PRIORITY_COUNT; i++) {
+        NVIC_SetPriority(irqPriorityTable[i].irq, 0);
+    }
+}
+
+// ==================== Priority Stress Benchmark ====================
+// With IRQ_BENCH_ENABLED the sensor is held still and ranged repeatedly
+// while a slow button interrupt is fired right after each trigger pulse,
+// i.e. while the echo edges arrive. The injected handler busy-waits for
+// IRQ_BENCH_LOAD_CYCLES, standing in for a slow low-priority handler such as
+// the UART print and LCD redraw GPIOE_Handler used to perform. The absolute error against a quiet reference
+// is collected in log2 buckets for the flat (reset) priorities and for the
+// plan above, and both distributions are printed over UART0.
+
+#ifndef IRQ_BENCH_ENABLED
+#define IRQ_BENCH_ENABLED 0
+#endif
+
+#if IRQ_BENCH_ENABLED
+
+#define IRQ_BENCH_SAMPLES     64
+#define IRQ_BENCH_LOAD_CYCLES (CLOCK_HZ / 1000 * 5)   // 5 ms
+#define IRQ_BENCH_BUCKETS     8             // 0, 1, 2-3, ... 64+ cm
+
+static volatile uint32_t irqBenchLoad = 0;  // Busy cycles for the next GPIOE entry
+
+// Called at the top of GPIOE_Handler: burn the injected load once
+#define IRQ_BENCH_LOAD() IrqBench_Load()
+
+void IrqBench_Load(void);
+void IrqBench_Run(void);
+
+// Busy-wait for the pending injected load, if any
+void IrqBench_Load(void) {
+    uint32_t load = irqBenchLoad;
+    if (load) {
+        uint32_t start = DWT->CYCCNT;
+        irqBenchLoad = 0;
+        while ((DWT->CYCCNT - start) < load);
+    }
+}
+
+// Range once, optionally firing the slow button interrupt during the echo
+static uint32_t IrqBench_Range(uint8_t inject) {
+    TriggerPulse();
+    if (inject) {
+        irqBenchLoad = IRQ_BENCH_LOAD_CYCLES;
+        IsrStats_Probe(ISR_GPIOE);
+    }
+    uint64_t trigger = DistanceSensor_TriggerTime();
+    EchoRecord echo;
+    SoftTimer_DelayMs(15);  // Same echo window as the scan
+    return DistanceSensor_TakeEcho(trigger, &echo) ? echo.distance : DISTANCE_NO_ECHO;
+}
+
+// One pass of IRQ_BENCH_SAMPLES injected rangings, errors binned against reference
+static void IrqBench_Pass(const char *name, uint32_t reference) {
+    uint32_t hist[IRQ_BENCH_BUCKETS] = {0};
+
+    for (int i = 0; i < IRQ_BENCH_SAMPLES; i++) {
+        uint32_t d = IrqBench_Range(1);
+        uint32_t err = (d > reference) ? d - reference : reference - d;
+        uint32_t bucket = err ? 32 - __CLZ(err) : 0;   // 0, 1, 2-3, 4-7, ...
+        if (bucket >= IRQ_BENCH_BUCKETS) bucket = IRQ_BENCH_BUCKETS - 1;
+        hist[bucket]++;
+    }
+
+    printString(name);
+    printString(" |err| cm buckets (0,1,2-3,4-7,..):");
+    for (int b = 0; b < IRQ_BENCH_BUCKETS; b++) {
+        printChar(' ');
+        printInt(hist[b]);
+    }
+    printString("\r\n");
+}
+
+// Run the benchmark; leaves the priority plan applied
+void IrqBench_Run(void) {
+    uint16_t quiet[IRQ_BENCH_SAMPLES];
+
+    // Reference: median of undisturbed rangings
+    IrqPriority_Init();
+    for (int i = 0; i < IRQ_BENCH_SAMPLES; i++) {
+        uint16_t d = IrqBench_Range(0);
+        int j = i;
+        while (j > 0 && quiet[j - 1] > d) {   // Insertion sort as we go
+            quiet[j] = quiet[j - 1];
+            j--;
+        }
+        quiet[j] = d;
+    }
+    uint32_t reference = quiet[IRQ_BENCH_SAMPLES / 2];
+    printString("IRQ bench reference (cm): ");
+    printInt(reference);
+    printString("\r\n");
+
+    IrqPriority_Flat();
+    IrqBench_Pass("flat", reference);
+
+    IrqPriority_Init();
+    IrqBench_Pass("plan", reference);
+}
+
+#else
+
+#define IRQ_BENCH_LOAD() ((void)0)
+#define IrqBench_Run()   ((void)0)
+
+#endif // IRQ_BENCH_ENABLED
+
+#endif // IRQ_PRIORITY_H
@@ -0,0 +1,177 @@
+#ifndef ISR_STATS_H
+#define ISR_STATS_H
+
+#include "TM4C123.h"
+#include <stdint.h>
+#include "profile.h"
+
+// ==================== ISR Latency and Duration Histograms ====================
+// For each instrumented handler two log2 histograms of CPU cycles are kept:
+//   latency  - hardware event to the first instruction of the handler
+//   duration - first instruction to return
+// Bucket k counts values in [2^k, 2^(k+1)); bucket 0 also holds 0 cycles and
+// the last bucket holds everything longer. Uses the DWT cycle counter;
+// IsrStats_Reset() starts it, so the histograms work without Profile_Init().
+//
+// Latency needs the time of the hardware event:
+//   WTIMER0A - the capture register already holds it (timer ticks = cycles)
+//   others   - no hardware timestamp exists, so latency is recorded only for
+//              the entries that were held off by another instrumented
+//              handler: on exit each handler stamps the instrumented IRQs
+//              left pending with its own entry time, an upper bound on when
+//              they were raised. An entry that found the core free, or was
+//              held off by an uninstrumented handler, is not recorded. The
+//              COMP0, GPIOE and I2C0 latency histograms are therefore upper
+//              bounds over the held-off entries only, not a distribution of
+//              every entry; their counts need not match the duration counts.
+//   bench    - IsrStats_Probe() stamps CYCCNT and pends the IRQ in software,
+//              which measures NVIC entry plus any blocking by other handlers
+//
+// Set ISR_STATS_ENABLED to 0 to compile the instrumentation out.
+
+#ifndef ISR_STATS_ENABLED
+#define ISR_STATS_ENABLED 1
+#endif
+
+#define ISR_HIST_BUCKETS 24   // Up to 2^23 cycles (~0.1 s at 80 MHz)
+
+typedef enum {
+    ISR_COMP0,
+    ISR_GPIOE,
+    ISR_WTIMER0A,
+    ISR_I2C0,
+    ISR_ID_COUNT
+} IsrId;
+
+typedef struct {
+    uint32_t latency[ISR_HIST_BUCKETS];
+    uint32_t duration[ISR_HIST_BUCKETS];
+    uint32_t maxLatency;      // Worst latency seen, cycles
+    uint32_t maxDuration;     // Worst duration seen, cycles
+} IsrHistogram;
+
+#if ISR_STATS_ENABLED
+
+static IsrHistogram isrHistograms[ISR_ID_COUNT];
+static volatile uint32_t isrProbeStamp[ISR_ID_COUNT];   // CYCCNT when last seen raised, 0 = none
+static const IRQn_Type isrIrqNumbers[ISR_ID_COUNT] = {
+    COMP0_IRQn, GPIOE_IRQn, WTIMER0A_IRQn, I2C0_IRQn
+};
+static const char * const isrNames[ISR_ID_COUNT] = {
+    "COMP0", "GPIOE", "WTIMER0A", "I2C0"
+};
+
+// Start of handler: remember the entry cycle count
+#define ISR_STATS_ENTER(id)        uint32_t isrEntryCycles = DWT->CYCCNT; IsrStats_Entry((id), isrEntryCycles)
+// End of handler: record how long it ran
+#define ISR_STATS_EXIT(id)         IsrStats_Exit((id), isrEntryCycles)
+// Record a latency measured from a hardware timestamp
+#define ISR_STATS_LATENCY(id, cyc) IsrStats_Add(isrHistograms[(id)].latency, &isrHistograms[(id)].maxLatency, (cyc))
+// CYCCNT as a stamp; 0 means "no stamp"
+#define ISR_STATS_STAMP(cyc)       ((cyc) ? (cyc) : 1)
+
+// Function prototypes
+void IsrStats_Reset(void);
+void IsrStats_Add(uint32_t *hist, uint32_t *max, uint32_t cycles);
+void IsrStats_Entry(IsrId id, uint32_t entryCycles);
+void IsrStats_Exit(IsrId id, uint32_t entryCycles);
+void IsrStats_Probe(IsrId id);
+const IsrHistogram *IsrStats_Get(IsrId id);
+void IsrStats_Dump(void);
+
+// Start the cycle counter and clear all histograms
+void IsrStats_Reset(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;  // Enable trace/DWT block
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;             // Start CYCCNT (left running if it is)
+    for (int i = 0; i < ISR_ID_COUNT; i++) {
+        for (int b = 0; b < ISR_HIST_BUCKETS; b++) {
+            isrHistograms[i].latency[b] = 0;
+            isrHistograms[i].duration[b] = 0;
+        }
+        isrHistograms[i].maxLatency = 0;
+        isrHistograms[i].maxDuration = 0;
+        isrProbeStamp[i] = 0;
+    }
+}
+
+// Count one value into a log2 histogram
+void IsrStats_Add(uint32_t *hist, uint32_t *max, uint32_t cycles) {
+    uint32_t bucket = cycles ? 31 - __CLZ(cycles) : 0;   // floor(log2(cycles))
+    if (bucket >= ISR_HIST_BUCKETS) bucket = ISR_HIST_BUCKETS - 1;
+    hist[bucket]++;
+    if (cycles > *max) *max = cycles;
+}
+
+// Handler entry: close out a probe or blocked-entry stamp, if any
+void IsrStats_Entry(IsrId id, uint32_t entryCycles) {
+    uint32_t stamp = isrProbeStamp[id];
+    if (stamp) {
+        isrProbeStamp[id] = 0;
+        ISR_STATS_LATENCY(id, entryCycles - stamp);
+    }
+}
+
+// Handler exit: record the execution time, and stamp the instrumented IRQs
+// this handler held off so their entries record a latency
+void IsrStats_Exit(IsrId id, uint32_t entryCycles) {
+    IsrStats_Add(isrHistograms[id].duration, &isrHistograms[id].maxDuration, DWT->CYCCNT - entryCycles);
+    for (IsrId i = ISR_COMP0; i < ISR_ID_COUNT; i++) {
+        if (i == id || i == ISR_WTIMER0A || isrProbeStamp[i]) continue;   // WTIMER0A: capture register
+        if (NVIC_GetPendingIRQ(isrIrqNumbers[i])) {
+            isrProbeStamp[i] = ISR_STATS_STAMP(entryCycles);   // Raised at or after our entry
+        }
+    }
+}
+
+// Pend an IRQ from software and stamp the time, so its next entry records latency
+void IsrStats_Probe(IsrId id) {
+    uint32_t stamp = DWT->CYCCNT;
+    isrProbeStamp[id] = ISR_STATS_STAMP(stamp);
+    NVIC_SetPendingIRQ(isrIrqNumbers[id]);
+}
+
+// Read access to one handler's histograms
+const IsrHistogram *IsrStats_Get(IsrId id) {
+    return &isrHistograms[id];
+}
+
+// Print non-empty buckets: "<isr> lat|dur <bucket>:<count> ... max <cycles>"
+static void IsrStats_DumpHist(const char *name, const char *kind, const uint32_t *hist, uint32_t max) {
+    printString(name);
+    printChar(' ');
+    printString(kind);
+    for (int b = 0; b < ISR_HIST_BUCKETS; b++) {
+        if (hist[b] == 0) continue;
+        printChar(' ');
+        printInt(b);
+        printChar(':');
+        printInt(hist[b]);
+    }
+    printString(" max ");
+    printInt(max);
+    printString("\r\n");
+}
+
+// Dump every handler's histograms over UART0 (bucket = log2 cycles). Only
+// WTIMER0A's "lat" covers every entry; the others are upper bounds over the
+// entries another instrumented handler held off.
+void IsrStats_Dump(void) {
+    for (int i = 0; i < ISR_ID_COUNT; i++) {
+        const IsrHistogram *h = &isrHistograms[i];
+        IsrStats_DumpHist(isrNames[i], "lat", h->latency, h->maxLatency);
+        IsrStats_DumpHist(isrNames[i], "dur", h->duration, h->maxDuration);
+    }
+}
+
+#else
+
+#define ISR_STATS_ENTER(id)        ((void)0)
+#define ISR_STATS_EXIT(id)         ((void)0)
+#define ISR_STATS_LATENCY(id, cyc) ((void)0)
+#define IsrStats_Reset()           ((void)0)
+#define IsrStats_Probe(id)         ((void)0)
+#define IsrStats_Dump()            ((void)0)
+
+#endif // ISR_STATS_ENABLED
+
+#endif // ISR_STATS_H
@@ -0,0 +1,368 @@
+#ifndef KERNEL_H
+#define KERNEL_H
+
+#include "TM4C123.h"
+#include <stdint.h>
+#include <string.h>
+#include "profile.h"
+#include "atomic.h"
+#include "main_api.h"
+
+// ==================== Fixed-Priority Preemptive Kernel ====================
+// A small kernel for a handful of tasks created at startup:
+//   - each task has a static stack and a fixed priority (0 = most urgent);
+//     the highest-priority ready task always runs, ties go to the task
+//     created first
+//   - SysTick provides a 1 ms tick for sleeps and timeouts
+//   - PendSV (kernel_switch.s) performs the context switch; the FPU
+//     registers s16-s31 are saved only for tasks that have used the FPU
+//   - counting semaphores and fixed-size message queues block the caller;
+//     posts and non-blocking sends are safe from ISRs
+//
+// SysTick and PendSV must be at the lowest NVIC priority (irq_priority.h),
+// so a switch only happens once every interrupt handler has returned.
+// Kernel state is guarded by Atomic_Enter/Exit (atomic.h); ISRs above
+// ATOMIC_SYSCALL_PRIORITY must not call into the kernel.
+//
+// The PendSV save/restore path is recorded in the PROF_CONTEXT_SWITCH
+// profiling zone.
+
+#define KERNEL_MAX_TASKS        8
+#define KERNEL_TICK_HZ          1000
+#define KERNEL_MS_TO_TICKS(ms)  ((ms) * KERNEL_TICK_HZ / 1000)
+#define KERNEL_WAIT_FOREVER     0xFFFFFFFF
+#define KERNEL_IDLE_PRIORITY    255
+#define KERNEL_IDLE_STACK_WORDS 128
+
+// Task stack: words of 32 bits, 8-byte aligned as the AAPCS requires
+#define KERNEL_STACK(name, words) static uint32_t name[(words)] __attribute__((aligned(8)))
+
+typedef struct {
+    volatile int32_t count;   // Units available
+    int32_t max;              // Posts beyond this are discarded (1 = binary semaphore)
+} Semaphore;
+
+#define KERNEL_SEM_INIT(count, max) { (count), (max) }
+
+typedef enum {
+    TASK_READY,
+    TASK_BLOCKED
+} TaskState;
+
+typedef void (*TaskEntry)(void *arg);
+
+typedef struct {
+    uint32_t *sp;               // Saved stack pointer; must stay first (kernel_switch.s)
+    const char *name;
+    uint8_t priority;           // 0 = most urgent
+    volatile uint8_t state;     // TaskState
+    volatile uint8_t timedOut;  // Last block ended by its timeout, not by a post
+    uint8_t hasTimeout;         // Blocked with a timeout
+    Semaphore *waitSem;         // Semaphore blocked on, 0 when sleeping
+    uint32_t wakeTick;          // Tick at which a timed block ends
+} Task;
+
+// Fixed-size message queue: a ring of elements guarded by two semaphores
+typedef struct {
+    uint8_t *buffer;            // capacity * elementSize bytes
+    uint32_t elementSize;
+    uint32_t capacity;
+    uint32_t head;              // Next element to receive
+    uint32_t tail;              // Next free slot
+    Semaphore items;            // Elements queued
+    Semaphore slots;            // Free slots
+} MsgQueue;
+
+#define KERNEL_QUEUE_DEFINE(name, type, capacity)                           \
+    static type name##Storage[(capacity)];                                  \
+    static MsgQueue name = { (uint8_t *)name##Storage, sizeof(type), (capacity), 0, 0, \
+                             KERNEL_SEM_INIT(0, (capacity)), KERNEL_SEM_INIT((capacity), (capacity)) }
+
+// Switch state shared with kernel_switch.s
+Task *volatile kernelCurrent = 0;   // Running task (0 before the first switch)
+Task *volatile kernelNext = 0;      // Task PendSV switches to
+const uint32_t kernelBasepri = ATOMIC_BASEPRI;   // PendSV's critical section mask
+
+static Task *kernelTasks[KERNEL_MAX_TASKS];   // Sorted by priority
+static uint8_t kernelTaskCount = 0;
+static volatile uint32_t kernelTicks = 0;
+static volatile uint8_t kernelRunning = 0;
+
+static Task kernelIdleTask;
+KERNEL_STACK(kernelIdleStack, KERNEL_IDLE_STACK_WORDS);
+
+// Function prototypes
+void Kernel_CreateTask(Task *task, const char *name, TaskEntry entry, void *arg,
+                       uint32_t *stack, uint32_t stackWords, uint8_t priority);
+void Kernel_Start(void);
+uint8_t Kernel_Running(void);
+uint32_t Kernel_Ticks(void);
+void Kernel_Sleep(uint32_t ticks);
+void Kernel_SuspendTick(void);
+void Kernel_ResumeTick(void);
+uint8_t Kernel_SemWait(Semaphore *sem, uint32_t timeoutTicks);
+void Kernel_SemPost(Semaphore *sem);
+void Kernel_SemReset(Semaphore *sem);
+uint8_t Kernel_QueueSend(MsgQueue *q, const void *msg, uint32_t timeoutTicks);
+uint8_t Kernel_QueueReceive(MsgQueue *q, void *msg, uint32_t timeoutTicks);
+void SysTick_Handler(void);
+void Kernel_SwitchEnter(void);
+void Kernel_SwitchExit(void);
+
+// A task function returned: park it for good
+static void Kernel_TaskExit(void) {
+    while (1) {
+        Kernel_Sleep(KERNEL_WAIT_FOREVER);
+    }
+}
+
+// Lowest priority task: sleep until the next interrupt
+static void Kernel_IdleTask(void *arg) {
+    (void)arg;
+    while (1) {
+        __WFI();
+    }
+}
+
+// Create a task. Its first run starts entry(arg) with an empty FPU context.
+// Must be called before Kernel_Start().
+void Kernel_CreateTask(Task *task, const char *name, TaskEntry entry, void *arg,
+                       uint32_t *stack, uint32_t stackWords, uint8_t priority) {
+    uint32_t *sp = (uint32_t *)((uintptr_t)&stack[stackWords] & ~(uintptr_t)7);
+
+    // Exception frame popped by the hardware on the first exception return
+    *--sp = 0x01000000;                     // xPSR: Thumb state
+    *--sp = (uint32_t)entry & ~1u;          // PC
+    *--sp = (uint32_t)Kernel_TaskExit;      // LR
+    *--sp = 0;                              // R12
+    *--sp = 0;                              // R3
+    *--sp = 0;                              // R2
+    *--sp = 0;                              // R1
+    *--sp = (uint32_t)arg;                  // R0
+    // Software frame popped by PendSV_Handler
+    *--sp = 0xFFFFFFFD;                     // EXC_RETURN: thread mode, PSP, no FP frame
+    for (int i = 0; i < 8; i++) {
+        *--sp = 0;                          // R11..R4
+    }
+
+    task->sp = sp;
+    task->name = name;
+    task->priority = priority;
+    task->state = TASK_READY;
+    task->timedOut = 0;
+    task->hasTimeout = 0;
+    task->waitSem = 0;
+    task->wakeTick = 0;
+
+    // Insert sorted by priority, after tasks of the same priority
+    int i = kernelTaskCount;
+    while (i > 0 && kernelTasks[i - 1]->priority > priority) {
+        kernelTasks[i] = kernelTasks[i - 1];
+        i--;
+    }
+    kernelTasks[i] = task;
+    kernelTaskCount++;
+}
+
+// Pick the highest-priority ready task and pend PendSV if it is not running.
+// Call inside a critical section.
+static void Kernel_Schedule(void) {
+    Task *next = 0;
+
+    if (!kernelRunning) return;
+
+    for (int i = 0; i < kernelTaskCount; i++) {
+        if (kernelTasks[i]->state == TASK_READY) {
+            next = kernelTasks[i];
+            break;
+        }
+    }
+    kernelNext = next;   // The idle task is always ready
+    if (next != kernelCurrent) {
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    }
+}
+
+// Make a blocked task ready again
+static void Kernel_Unblock(Task *task, uint8_t timedOut) {
+    task->state = TASK_READY;
+    task->timedOut = timedOut;
+    task->hasTimeout = 0;
+    task->waitSem = 0;
+}
+
+// Block the running task on sem (0 = plain sleep) and switch away. Entered
+// inside a critical section; state is the Atomic_Enter() result. The switch
+// needs BASEPRI at 0, so a caller inside an outer critical section loses it
+// while blocked; state is raised again once the task runs.
+// Returns 1 if woken by a post, 0 on timeout.
+static uint8_t Kernel_Block(Semaphore *sem, uint32_t timeoutTicks, uint32_t state) {
+    Task *self = kernelCurrent;
+
+    self->state = TASK_BLOCKED;
+    self->waitSem = sem;
+    self->timedOut = 0;
+    self->hasTimeout = (timeoutTicks != KERNEL_WAIT_FOREVER);
+    self->wakeTick = kernelTicks + timeoutTicks;
+    Kernel_Schedule();
+    Atomic_Exit(0);       // PendSV switches away here
+    Atomic_Exit(state);
+    return !self->timedOut;
+}
+
+// Called by PendSV_Handler around its save/restore, with BASEPRI raised.
+// PendSV does not nest, so one start stamp serves every switch.
+#if PROFILE_ENABLED
+static uint32_t kernelSwitchStart;
+#endif
+
+void Kernel_SwitchEnter(void) {
+#if PROFILE_ENABLED
+    kernelSwitchStart = DWT->CYCCNT;
+#endif
+}
+
+void Kernel_SwitchExit(void) {
+#if PROFILE_ENABLED
+    Profile_Record(PROF_CONTEXT_SWITCH, DWT->CYCCNT - kernelSwitchStart);
+#endif
+}
+
+// Start SysTick and switch to the highest-priority task. Never returns.
+void Kernel_Start(void) {
+    Kernel_CreateTask(&kernelIdleTask, "idle", Kernel_IdleTask, 0,
+                      kernelIdleStack, KERNEL_IDLE_STACK_WORDS, KERNEL_IDLE_PRIORITY);
+
+    SysTick->CTRL = 0;
+    SysTick->LOAD = SystemCoreClock / KERNEL_TICK_HZ - 1;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    uint32_t state = Atomic_Enter();
+    kernelRunning = 1;
+    Kernel_Schedule();
+    Atomic_Exit(state);       // PendSV starts the first task; main's stack becomes the ISR stack
+
+    while (1);
+}
+
+// Nonzero once Kernel_Start() has run (task context is available)
+uint8_t Kernel_Running(void) {
+    return kernelRunning;
+}
+
+// Ticks since Kernel_Start()
+uint32_t Kernel_Ticks(void) {
+    return kernelTicks;
+}
+
+// Block the running task for ticks kernel ticks
+void Kernel_Sleep(uint32_t ticks) {
+    uint32_t state = Atomic_Enter();
+    Kernel_Block(0, ticks, state);
+}
+
+// Stop the tick, e.g. around deep sleep so SysTick does not wake the core
+void Kernel_SuspendTick(void) {
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+}
+
+// Restart the tick stopped by Kernel_SuspendTick()
+void Kernel_ResumeTick(void) {
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+}
+
+// Take one unit, blocking for up to timeoutTicks. A timeout of 0 polls and
+// is the only form allowed from an ISR. Returns 1 if taken, 0 on timeout.
+uint8_t Kernel_SemWait(Semaphore *sem, uint32_t timeoutTicks) {
+    uint32_t state = Atomic_Enter();
+
+    if (sem->count > 0) {
+        sem->count--;
+        Atomic_Exit(state);
+        return 1;
+    }
+    if (timeoutTicks == 0 || !kernelRunning) {
+        Atomic_Exit(state);
+        return 0;
+    }
+    return Kernel_Block(sem, timeoutTicks, state);
+}
+
+// Give one unit: wake the highest-priority waiter, or count it (up to max).
+// Safe from ISRs.
+void Kernel_SemPost(Semaphore *sem) {
+    uint32_t state = Atomic_Enter();
+
+    for (int i = 0; i < kernelTaskCount; i++) {
+        Task *t = kernelTasks[i];
+        if (t->state == TASK_BLOCKED && t->waitSem == sem) {
+            Kernel_Unblock(t, 0);   // The unit goes straight to the waiter
+            Kernel_Schedule();
+            Atomic_Exit(state);
+            return;
+        }
+    }
+    if (sem->count < sem->max) {
+        sem->count++;
+    }
+    Atomic_Exit(state);
+}
+
+// Drop any units posted so far
+void Kernel_SemReset(Semaphore *sem) {
+    uint32_t state = Atomic_Enter();
+    sem->count = 0;
+    Atomic_Exit(state);
+}
+
+// Copy msg into the queue, blocking up to timeoutTicks for a free slot.
+// Returns 0 if the queue stayed full.
+uint8_t Kernel_QueueSend(MsgQueue *q, const void *msg, uint32_t timeoutTicks) {
+    if (!Kernel_SemWait(&q->slots, timeoutTicks)) {
+        return 0;
+    }
+
+    uint32_t state = Atomic_Enter();
+    memcpy(&q->buffer[q->tail * q->elementSize], msg, q->elementSize);
+    q->tail = (q->tail + 1 == q->capacity) ? 0 : q->tail + 1;
+    Atomic_Exit(state);
+
+    Kernel_SemPost(&q->items);
+    return 1;
+}
+
+// Copy the oldest message into msg, blocking up to timeoutTicks for one.
+// Returns 0 if the queue stayed empty.
+uint8_t Kernel_QueueReceive(MsgQueue *q, void *msg, uint32_t timeoutTicks) {
+    if (!Kernel_SemWait(&q->items, timeoutTicks)) {
+        return 0;
+    }
+
+    uint32_t state = Atomic_Enter();
+    memcpy(msg, &q->buffer[q->head * q->elementSize], q->elementSize);
+    q->head = (q->head + 1 == q->capacity) ? 0 : q->head + 1;
+    Atomic_Exit(state);
+
+    Kernel_SemPost(&q->slots);
+    return 1;
+}
+
+// Kernel tick: end expired sleeps and timeouts
+void SysTick_Handler(void) {
+    uint32_t state = Atomic_Enter();
+
+    uint32_t now = ++kernelTicks;
+    for (int i = 0; i < kernelTaskCount; i++) {
+        Task *t = kernelTasks[i];
+        if (t->state == TASK_BLOCKED && t->hasTimeout && (int32_t)(now - t->wakeTick) >= 0) {
+            Kernel_Unblock(t, 1);
+        }
+    }
+    Kernel_Schedule();
+
+    Atomic_Exit(state);
+}
+
+#endif // KERNEL_H
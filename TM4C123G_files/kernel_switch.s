@@ -0,0 +1,73 @@
+; kernel_switch.s
+; Runs on TM4C123
+;
+; PendSV context switch for the kernel in kernel.h. Saves the running task's
+; R4-R11 and EXC_RETURN on its process stack (plus s16-s31 when the task has
+; an active FPU context, EXC_RETURN bit 4 clear), stores the stack pointer in
+; kernelCurrent->sp, then restores kernelNext the same way. The hardware
+; stacks and restores R0-R3, R12, LR, PC, xPSR (and s0-s15, FPSCR lazily).
+; Kernel_SwitchEnter/Exit time the save/restore for the PROF_CONTEXT_SWITCH
+; profiling zone.
+;
+; Must run at the lowest exception priority so it never interrupts a handler.
+; Kernel state is guarded by raising BASEPRI to kernelBasepri, which kernel.h
+; sets from ATOMIC_BASEPRI so the mask is defined in atomic.h only; the echo
+; capture IRQ above that level never touches it.
+;
+; BASEPRI is not saved per task. Any nonzero BASEPRI masks PendSV, the lowest
+; priority, so PendSV only ever runs with BASEPRI at 0 (Kernel_Block drops
+; it before switching), and writing 0 on the way out restores that value.
+
+    AREA KernelSwitchCode, CODE, READONLY
+    THUMB
+    PRESERVE8
+
+    EXPORT PendSV_Handler
+    IMPORT kernelCurrent
+    IMPORT kernelNext
+    IMPORT kernelBasepri
+    IMPORT Kernel_SwitchEnter
+    IMPORT Kernel_SwitchExit
+
+; ==================== PendSV Context Switch ====================
+PendSV_Handler
+    LDR     R3, =kernelBasepri
+    LDR     R3, [R3]
+    MSR     BASEPRI, R3          ; kernelNext must not change mid-switch
+    ISB
+    PUSH    {R0, LR}             ; Two words keep MSP 8-byte aligned
+    BL      Kernel_SwitchEnter
+    POP     {R0, LR}
+
+    LDR     R1, =kernelCurrent
+    LDR     R2, [R1]             ; R2 = running task
+    CBZ     R2, RestoreNext      ; First switch from main: nothing to save
+
+    MRS     R0, PSP
+    TST     LR, #0x10            ; EXC_RETURN bit 4 clear: task uses the FPU
+    IT      EQ
+    VSTMDBEQ R0!, {S16-S31}
+    STMDB   R0!, {R4-R11, LR}
+    STR     R0, [R2]             ; kernelCurrent->sp = PSP
+
+RestoreNext
+    LDR     R2, =kernelNext
+    LDR     R2, [R2]
+    STR     R2, [R1]             ; kernelCurrent = kernelNext
+
+    LDR     R0, [R2]             ; R0 = kernelNext->sp
+    LDMIA   R0!, {R4-R11, LR}
+    TST     LR, #0x10
+    IT      EQ
+    VLDMIAEQ R0!, {S16-S31}
+    MSR     PSP, R0
+    PUSH    {R0, LR}             ; LR = the next task's EXC_RETURN
+    BL      Kernel_SwitchExit
+    POP     {R0, LR}
+
+    MOV     R3, #0
+    MSR     BASEPRI, R3          ; The value on entry: see above
+    BX      LR                   ; Exception return into the task (thread mode, PSP)
+
+    ALIGN
+    END
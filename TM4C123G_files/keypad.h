@@ -3,7 +3,7 @@
 
 #include <stdint.h>
 #include "tm4c123gh6pm.h"
-#include "timer_init.h"  // For Timer0_DelayMs
+#include "soft_timer.h"  // For SoftTimer_DelayMs
 
 /*
  * Keypad_Read:
@@ -21,7 +21,7 @@ uint32_t Keypad_Read(void) {
         GPIO_PORTB_DATA_R &= ~(1 << (4 + row));  // Set the selected row low (B4+B-row)
 
         // Wait for a short delay to debounce
-        Timer5_DelayMs(5);
+        SoftTimer_DelayMs(5);
 
         // Read the columns (B0-B3)
         uint32_t colState = GPIO_PORTB_DATA_R & 0x0F;  // Mask to read columns only
@@ -68,7 +68,7 @@ uint32_t Keypad_GetPressedButton(void) {
     // Check for a valid keypad button press
     if (keypadButton != 0) {
         // Debounce the keypad button
-        Timer5_DelayMs(10);  // Additional debounce delay
+        SoftTimer_DelayMs(10);  // Additional debounce delay
         if (Keypad_Read() == keypadButton) {
             return keypadButton;
         }
@@ -77,7 +77,7 @@ uint32_t Keypad_GetPressedButton(void) {
     // Check for a valid push button press
     if (pushButton != 0) {
         // Debounce the push button
-        Timer5_DelayMs(10);  // Additional debounce delay
+        SoftTimer_DelayMs(10);  // Additional debounce delay
         if (PushButtons_Read() == pushButton) {
             return pushButton;
         }
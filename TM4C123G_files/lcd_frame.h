@@ -0,0 +1,118 @@
+#ifndef LCD_FRAME_H
+#define LCD_FRAME_H
+
+#include <stdint.h>
+#include "Nokia5110.h"
+#include "kernel.h"
+#include "profile.h"
+#include "gfx.h"
+#include "font.h"
+#include "font_5x8.h"
+#include "font_digits16.h"
+
+// ==================== LCD Frames ====================
+// The Nokia5110 driver is double buffered. Everything is drawn into the back
+// buffer (Screen, through gfx.h and font.h) between Lcd_BeginFrame() and
+// Lcd_ShowFrame(). Lcd_ShowFrame hands the frame to Nokia5110_SwapBuffers and
+// returns at once: the driver swaps it to the front when the previous frame
+// has finished streaming out by uDMA, then sends the columns that changed.
+// Lcd_BeginFrame blocks only while such a swap is still pending, so frame
+// N+1 is drawn while frame N is on the wire and the panel never receives a
+// half-drawn frame. The swaps chain from SSI0_Handler; no task is involved.
+//
+// Before Kernel_Start() frames are sent with the blocking
+// Nokia5110_DisplayBuffer. Lcd_Init() registers the flush-complete callback
+// Lcd_Flush waits on; call it after Nokia5110_Init().
+
+#define LCD_TEXT_COLUMNS 12   // 12 x 6 characters of 5x8 fill the screen
+#define LCD_TEXT_ROWS    6
+
+static volatile uint8_t lcdSwapPending = 0;   // Screen handed over, not yet swapped
+static Semaphore lcdSwapped = KERNEL_SEM_INIT(0, 1);   // Posted from SSI0_Handler
+static Semaphore lcdFlushed = KERNEL_SEM_INIT(0, 1);   // Posted when the last flush ends
+
+// Function prototypes
+void Lcd_Init(void);
+void Lcd_BeginFrame(void);
+void Lcd_ShowFrame(void);
+void Lcd_ShowText(const char *text);
+void Lcd_ShowReading(const char *label, const char *value);
+void Lcd_Flush(void);
+
+// The pending swap happened: Screen may be drawn again
+static void Lcd_Swapped(void *arg) {
+    (void)arg;
+    lcdSwapPending = 0;
+    Kernel_SemPost(&lcdSwapped);
+}
+
+// Every frame handed over is on the panel
+static void Lcd_Flushed(void *arg) {
+    (void)arg;
+    Kernel_SemPost(&lcdFlushed);
+}
+
+// Hook Lcd_Flush up to the driver's flush-complete callback
+void Lcd_Init(void) {
+    Nokia5110_OnFlushDone(Lcd_Flushed, 0);
+}
+
+// Wait until Screen is free to draw the next frame
+void Lcd_BeginFrame(void) {
+    while (lcdSwapPending) {
+        Kernel_SemWait(&lcdSwapped, KERNEL_WAIT_FOREVER);   // A stale post just loops
+    }
+}
+
+// Hand the Screen buffer to the display
+void Lcd_ShowFrame(void) {
+    Lcd_BeginFrame();                           // Two frames with no drawing between
+    PROFILE_ENTER(PROF_DISPLAY_BUFFER);
+    if (Kernel_Running()) {
+        lcdSwapPending = 1;
+        Nokia5110_SwapBuffers(Lcd_Swapped, 0);  // CPU time to swap now or queue the swap
+    } else {
+        Nokia5110_DisplayBuffer();
+    }
+    PROFILE_EXIT(PROF_DISPLAY_BUFFER);
+}
+
+// Clear the screen and show text, wrapped at LCD_TEXT_COLUMNS and laid out
+// in the same 7-pixel cells as Nokia5110_OutString. '\n' starts a new row;
+// right after a full row it does not add a blank one.
+void Lcd_ShowText(const char *text) {
+    int32_t column = 0, row = 0;
+
+    Lcd_BeginFrame();
+    Nokia5110_ClearBuffer();
+    for (; *text; text++) {
+        if (*text == '\n' || column == LCD_TEXT_COLUMNS) {
+            column = 0;
+            row++;
+        }
+        if (row == LCD_TEXT_ROWS) break;
+        if (*text == '\n') continue;
+        Font_DrawChar(&font5x8, 7 * column + 1, 8 * row, *text, GFX_SET);
+        column++;
+    }
+    Lcd_ShowFrame();
+}
+
+// Clear the screen and show a small label over a centred big-digit value
+void Lcd_ShowReading(const char *label, const char *value) {
+    Lcd_BeginFrame();
+    Nokia5110_ClearBuffer();
+    Font_DrawString(&font5x8, 1, 0, label, GFX_SET);
+    Font_DrawString(&fontDigits16, (GFX_WIDTH - Font_StringWidth(&fontDigits16, value)) / 2,
+                    20, value, GFX_SET);
+    Lcd_ShowFrame();
+}
+
+// Block until every frame handed over has reached the display
+void Lcd_Flush(void) {
+    while (Nokia5110_FlushBusy()) {
+        Kernel_SemWait(&lcdFlushed, KERNEL_WAIT_FOREVER);   // A stale post just loops
+    }
+}
+
+#endif // LCD_FRAME_H
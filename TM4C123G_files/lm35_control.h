@@ -6,10 +6,18 @@
 #include <stdint.h>
 #include "printHelper.h"
 #include "Nokia5110.h"
-#include <stdio.h>
+#include "fmt.h"
+
+#include "soft_timer.h"
+#include "timebase.h"
+#include "wait.h"
+#include "isr_stats.h"
+#include "spsc.h"
+#include "kernel.h"
+#include "lcd_frame.h"
+#include "log.h"
 
 extern void Timer5_Init(void);
-extern void Timer5_DelayMs(uint32_t ms);
 extern void Timer5_DelayUs(uint32_t us);
 
 // Function Prototypes
@@ -17,7 +25,16 @@ void AnalogComparator_Init(void);
 void EnterDeepSleep(void);
 void COMP0_Handler(void);
 
-extern volatile float TEMP_THRESHOLD;
+extern volatile uint32_t TEMP_THRESHOLD;
+
+// One comparator wake, published by COMP0_Handler through compRing
+typedef struct {
+    uint32_t seq;          // Increments by one per interrupt
+    uint64_t timestamp;    // Timebase us of the interrupt
+} CompRecord;
+
+SPSC_DEFINE(compRing, CompRecord, 4);
+static uint32_t compSeq = 0;
 
 // Analog Comparator Initialization
 void AnalogComparator_Init(void) {
@@ -53,22 +70,37 @@ void AnalogComparator_Init(void) {
 void EnterDeepSleep(void) {
 		//lcd print
 		char temp_thresh[50];
-		Nokia5110_Clear();
-		sprintf(temp_thresh, "Limit: %.0f", TEMP_THRESHOLD);
-		Nokia5110_OutString(temp_thresh);
+		PROFILE_ENTER(PROF_FORMAT);
+		Fmt_Uint(Fmt_Str(temp_thresh, "Limit: "), TEMP_THRESHOLD, 0, ' ');
+		PROFILE_EXIT(PROF_FORMAT);
+		Lcd_ShowText(temp_thresh);
 		 
-		printString("Entering Deep Sleep...\r\n");
+		LOG_I(TEMP, "Entering Deep Sleep...");
+		Lcd_Flush();                  // Let the LCD flush and UART output finish first
+		Print_Flush();
 		//COMP_ACMIS_R |= 0x01;      // Clear ACMIS flag for Comparator 0
 		NVIC->ISER[0] &= ~(1 << 4);   // Disable interrupt for Port E
+		Kernel_SuspendTick();         // SysTick would end deep sleep every millisecond
 		SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;   // Set SLEEPDEEP bit in the System Control Block
 		NVIC_EnableIRQ(COMP0_IRQn);
-    __asm("WFI");                        // Wait For Interrupt instruction
+		__disable_irq();              // Check-then-sleep: only the comparator ends the wait
+		while (!Wait_Pending(WAIT_EVT_WAKE)) {
+		    __WFI();                  // Wait For Interrupt instruction
+		    __enable_irq();
+		    __disable_irq();
+		}
+		__enable_irq();
+		SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;  // Later WFIs (idle task) use normal sleep so the timers keep running
+		Kernel_ResumeTick();
 }
 
 void COMP0_Handler(void) {
-		
-    printString("Comparator Interrupt: Waking up from Deep Sleep...\r\n");
+		ISR_STATS_ENTER(ISR_COMP0);
+		CompRecord rec = { compSeq++, Timebase_NowUs() };
+		Spsc_Push(&compRing, &rec);
+		Wait_Signal(WAIT_EVT_WAKE);
 		COMP_ACMIS_R |= 0x01;      // Clear ACMIS flag for Comparator 0
+		ISR_STATS_EXIT(ISR_COMP0);
 }
 
 
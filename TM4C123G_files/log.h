@@ -0,0 +1,87 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+#include "blog.h"
+
+// ==================== Leveled Logging ====================
+// LOG_E / LOG_W / LOG_I / LOG_T (module, fmt, ...) log one line through
+// BLOG at error, warning, info or trace level. module is a bare LogModule
+// name without the prefix, e.g. LOG_I(APP, "Temp: %.2f", t).
+//
+// Two filters:
+//   LOG_LEVEL             compile time; levels above it expand to ((void)0),
+//                         so neither the call nor its arguments cost anything
+//   Log_SetLevel(m, lvl)  run time, per module; starts at LOG_LEVEL
+//
+// The level letter and module name are part of the format string, which
+// stays in .blog_fmt, so they cost no flash or UART bytes either.
+// Same context rules as BLOG: app task only, never from an ISR.
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_TRACE 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO   // Bench builds: -DLOG_LEVEL=4 for trace
+#endif
+
+typedef enum {
+    LOG_MOD_APP,      // Application state machine (main.c)
+    LOG_MOD_TEMP,     // LM35 comparator, deep sleep, BMP280
+    LOG_MOD_BTN,      // Push buttons
+    LOG_MOD_SCAN,     // Stepper scan and ranging
+    LOG_MOD_COUNT
+} LogModule;
+
+static volatile uint8_t logModuleLevel[LOG_MOD_COUNT] = {
+    LOG_LEVEL, LOG_LEVEL, LOG_LEVEL, LOG_LEVEL
+};
+
+// Function prototypes
+void Log_SetLevel(LogModule module, uint8_t level);
+uint8_t Log_GetLevel(LogModule module);
+
+#define LOG_EMIT(level, tag, module, fmt, ...) do { \
+    if (logModuleLevel[LOG_MOD_##module] >= (level)) { \
+        BLOG(tag " " #module ": " fmt, ##__VA_ARGS__); \
+    } \
+} while (0)
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(module, fmt, ...) LOG_EMIT(LOG_LEVEL_ERROR, "E", module, fmt, ##__VA_ARGS__)
+#else
+#define LOG_E(module, fmt, ...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(module, fmt, ...) LOG_EMIT(LOG_LEVEL_WARN, "W", module, fmt, ##__VA_ARGS__)
+#else
+#define LOG_W(module, fmt, ...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(module, fmt, ...) LOG_EMIT(LOG_LEVEL_INFO, "I", module, fmt, ##__VA_ARGS__)
+#else
+#define LOG_I(module, fmt, ...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_TRACE
+#define LOG_T(module, fmt, ...) LOG_EMIT(LOG_LEVEL_TRACE, "T", module, fmt, ##__VA_ARGS__)
+#else
+#define LOG_T(module, fmt, ...) ((void)0)
+#endif
+
+// Runtime level for one module; cannot raise it above LOG_LEVEL
+void Log_SetLevel(LogModule module, uint8_t level) {
+    if (module >= LOG_MOD_COUNT) return;
+    logModuleLevel[module] = (level > LOG_LEVEL) ? LOG_LEVEL : level;
+}
+
+uint8_t Log_GetLevel(LogModule module) {
+    return (module < LOG_MOD_COUNT) ? logModuleLevel[module] : LOG_LEVEL_NONE;
+}
+
+#endif // LOG_H
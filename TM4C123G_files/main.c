@@ -1,3 +1,4 @@
+#include "clock.h"
 #include "printHelper.h"
 #include "lm35_control.h"
 #include "bmp280.h"
@@ -6,26 +7,73 @@
 #include "PushButtons.h"  // Include push buttons header
 #include "DistanceSensor.h"
 #include "Nokia5110.h"
+#include "soft_timer.h"
+#include "event_loop.h"
+#include "timebase.h"
+#include "irq_priority.h"
+#include "wait.h"
+#include "kernel.h"
+#include "atomic.h"
+#include "lcd_frame.h"
+#include "log.h"
+#include "fmt.h"
+#include "console.h"
+#include "fpu.h"
 #include <stdint.h>
-#include <stdio.h>
 
-// Define temperature threshold as a global variable
-volatile float TEMP_THRESHOLD = 20.0;  // Threshold temperature in Celsius
-volatile uint8_t isDeepSleepPressed = 0;
-extern volatile uint32_t distance;
+// Define temperature threshold as a global variable. Whole degrees, so it is
+// a single word: change it only with Atomic_Add/Atomic_CompareExchange.
+volatile uint32_t TEMP_THRESHOLD = 20;  // Threshold temperature in Celsius
 
 extern void Timer5_Init(void);
-extern void Timer5_DelayMs(uint32_t ms);
 extern void Timer5_DelayUs(uint32_t us);
 
 // Function prototypes
 uint8_t CheckComparatorOutput(void);
-void StandbyMode(void);  // Standby mode to update temperature every 2 seconds
+void StandbyMode(void);  // Standby mode to update temperature every second
+void App_Sleep(void);
+void App_HandleEvent(const Event *evt);
+void App_Task(void *arg);
+
+#define STANDBY_PERIOD_MS 1000   // Standby temperature refresh
+#define SAMPLE_PERIOD_MS  10     // Spacing of averaging samples
+#define RESULT_HOLD_MS    5000   // Scan result stays on the LCD this long
+#define ALERT_DURATION_MS 3000   // Alert tone length
+
+// Tasks, most urgent first. Ranging preempts everything, the scan task runs
+// the motor steps, and the app task runs the event loop with the LCD drawing
+// and console output. UART output is interrupt driven and LCD frames stream
+// out by uDMA (lcd_frame.h), so neither needs a task of its own.
+#define TASK_PRIO_RANGE   1
+#define TASK_PRIO_SCAN    2
+#define TASK_PRIO_APP     3
+
+#define RANGE_STACK_WORDS 256
+#define SCAN_STACK_WORDS  512    // Scan stream frames
+#define APP_STACK_WORDS   1024   // Event handlers and LCD text buffers
+
+static Task rangeTask, scanTask, appTask;
+KERNEL_STACK(rangeStack, RANGE_STACK_WORDS);
+KERNEL_STACK(scanStack, SCAN_STACK_WORDS);
+KERNEL_STACK(appStack, APP_STACK_WORDS);
+
+static SoftTimer appTimer;       // Drives averaging, result hold and standby
+static float sampleSum;
+static uint8_t sampleCount;
 
 int main(void) {
     // Initialization
+    Clock_Init();              // PLL first: every driver derives its timing from SystemCoreClock
+    Fpu_Init();                // Lazy FP stacking before any ISR can use the FPU
+    Profile_Init();            // Start the DWT cycle counter
+    Uart0_Init(UART0_BAUD);    // UART0 once, interrupt-driven transmit and receive
+    Console_Init();            // Received lines become console commands
+    IsrStats_Reset();          // Start CYCCNT, clear ISR latency/duration histograms
 		Nokia5110_Init();
-    Timer5_Init();             // Initialize Timer5 for delays
+    Lcd_Init();                // Lcd_Flush waits for the driver's flush-complete callback
+    Timer5_Init();             // Initialize Timer5 for microsecond delays
+    SoftTimer_Init();          // Initialize Timer4 software timer service
+    Timebase_Init();           // Initialize Wide Timer 1 64-bit timebase
 		TimerWT0_Init();         	// Initialize Timer 1A
 		RGB_Init();
     BMP280_Init();             // Initialize BMP280 sensor
@@ -34,97 +82,185 @@ int main(void) {
     PushButtons_Init();        // Initialize push buttons with interrupts
 		DistanceSensor_Init();  		// Initialize the distance sensor
 		AnalogComparator_Init();   // Initialize the Analog Comparator
+    IrqPriority_Init();        // Apply the central NVIC priority plan
+    IrqBench_Run();            // Priority stress benchmark (IRQ_BENCH_ENABLED builds only)
+    Atomic_Bench();            // Primitive cycle costs (ATOMIC_BENCH_ENABLED builds only)
+    Fpu_Bench();               // Float path costs before/after (FPU_BENCH_ENABLED builds only)
+
+    // Each phase is a state machine advanced by events
+    EventLoop_Subscribe(EVT_WAKE, App_HandleEvent);
+    EventLoop_Subscribe(EVT_TEMP_SAMPLE, App_HandleEvent);
+    EventLoop_Subscribe(EVT_TEMP_DONE, App_HandleEvent);
+    EventLoop_Subscribe(EVT_SCAN_DONE, App_HandleEvent);
+    EventLoop_Subscribe(EVT_DISPLAY_DONE, App_HandleEvent);
+    EventLoop_Subscribe(EVT_STANDBY_TICK, App_HandleEvent);
+    EventLoop_Subscribe(EVT_SLEEP_REQUEST, App_HandleEvent);
+    EventLoop_Subscribe(EVT_BUTTON, PushButtons_HandleEvent);
+    EventLoop_Subscribe(EVT_PROFILE_DUMP, App_HandleEvent);
+    EventLoop_Subscribe(EVT_SCAN_REQUEST, App_HandleEvent);
+    EventLoop_Subscribe(EVT_CONSOLE_LINE, Console_HandleEvent);
+    EventLoop_Subscribe(EVT_SCAN_PLOT, StepperMotor_HandleDisplayEvent);
+    EventLoop_SubscribeTask(EVT_SCAN_START, StepperMotor_HandleEvent, &scanQueue);
+    EventLoop_SubscribeTask(EVT_SCAN_STOP, StepperMotor_HandleEvent, &scanQueue);
+    EventLoop_SubscribeTask(EVT_SCAN_SETTLED, StepperMotor_HandleEvent, &scanQueue);
+    EventLoop_SubscribeTask(EVT_SCAN_SAMPLE, StepperMotor_HandleEvent, &scanQueue);
+    EventLoop_SubscribeTask(EVT_SCAN_HOLD_DONE, StepperMotor_HandleEvent, &scanQueue);
+
+    Kernel_CreateTask(&rangeTask, "range", DistanceSensor_Task, 0, rangeStack, RANGE_STACK_WORDS, TASK_PRIO_RANGE);
+    Kernel_CreateTask(&scanTask, "scan", StepperMotor_Task, 0, scanStack, SCAN_STACK_WORDS, TASK_PRIO_SCAN);
+    Kernel_CreateTask(&appTask, "app", App_Task, 0, appStack, APP_STACK_WORDS, TASK_PRIO_APP);
+    Kernel_Start();            // Never returns; the idle task sleeps in WFI
+
+    return 0;
+}
+
+// App task: runs the event loop
+void App_Task(void *arg) {
+    (void)arg;
 
     // Enter deep sleep mode
     TurnOffPowerLED();
-    printString("System Initialized. Entering Deep Sleep...\r\n");
+    LOG_I(APP, "System Initialized. Entering Deep Sleep...");
+    App_Sleep();
+
+    EventLoop_Run();           // Never returns
+}
 
-    while (1) {
-				EnterDeepSleep();
-				isDeepSleepPressed = 0;
+// Stop everything that is running and wait in deep sleep for the comparator
+void App_Sleep(void) {
+    SoftTimer_Stop(&appTimer);
+    StepperMotor_StopScan();
+    StopSquareWave();
+    EventLoop_Flush();
+    Console_Poll();                // A command line pending in the flushed queue runs on wake
+    Wait_Clear(WAIT_EVT_CANCEL);   // The request that got us here is handled
+
+    EnterDeepSleep();
+    EventLoop_Post(EVT_WAKE, 0);
+}
+
+// Application state machine: wake -> average -> alert + scan -> hold -> standby
+void App_HandleEvent(const Event *evt) {
+    switch (evt->type) {
+    case EVT_WAKE: {
+				CompRecord wake;
+				Wait_Clear(WAIT_EVT_CANCEL | WAIT_EVT_WAKE);
+				while (Spsc_Pop(&compRing, &wake)) {
+				    LOG_I(TEMP, "Comparator Interrupt: Waking up from Deep Sleep...");
+				}
 				NVIC_DisableIRQ(COMP0_IRQn);
 				NVIC->ISER[0] |= (1 << 4);   // Enable interrupt for Port E
         // Check if comparator output indicates temperature increase
 					TurnOnPowerLED();
-					printString("Temperature threshold exceeded! Waking up...\r\n");
-
-					// Perform one full scan (128 samples)
-					float sum = 0;
-					for (uint8_t i = 0; i < FILTER_SIZE; i++) {
-							float temp = BMP280_ReadTemperature();
-							sum += temp;
-							Timer5_DelayMs(10);  // Small delay between samples
-					}
+					LOG_I(APP, "Temperature threshold exceeded! Waking up...");
+
+					// Perform one full scan (128 samples), one every SAMPLE_PERIOD_MS
+					sampleSum = 0;
+					sampleCount = 0;
+					SoftTimer_StartMs(&appTimer, SAMPLE_PERIOD_MS, SAMPLE_PERIOD_MS,
+					                  EventLoop_PostFromTimer, EVENT_ARG(EVT_TEMP_SAMPLE));
+					EventLoop_Post(EVT_TEMP_SAMPLE, 0);
+        break;
+    }
 
-					float averageTemperature = sum / FILTER_SIZE;
+    case EVT_TEMP_SAMPLE:
+        if (Wait_Pending(WAIT_EVT_CANCEL)) {   // Sleep requested: drop the average
+            SoftTimer_Stop(&appTimer);
+            break;
+        }
+        sampleSum += BMP280_ReadTemperature();
+        if (++sampleCount >= FILTER_SIZE) {
+            SoftTimer_Stop(&appTimer);
+            EventLoop_Post(EVT_TEMP_DONE, 0);
+        }
+        break;
+
+    case EVT_TEMP_DONE: {
+					float averageTemperature = sampleSum / FILTER_SIZE;
 					
 					//lcd print
 					char temperature[50];
-					Nokia5110_Clear();
-					sprintf(temperature, "Temp: %.2f", averageTemperature);
-					Nokia5110_OutString(temperature);
+					PROFILE_ENTER(PROF_FORMAT);
+					Fmt_Str(Fmt_Float(temperature, averageTemperature, 2), FONT_DEGREE "C");
+					PROFILE_EXIT(PROF_FORMAT);
+					Lcd_ShowReading("Temp", temperature);
 					
 					// Print the average temperature
-					printString("Average Temperature: ");
-					printFloat(averageTemperature, 2);
-					printString(" C\r\n");
+					LOG_I(TEMP, "Average Temperature: %.2f C", averageTemperature);
 
 					// Check if the average temperature is above the threshold
-					if (averageTemperature > TEMP_THRESHOLD) {
-							printString("ALERT: Temperature is above the threshold!\r\n");
+					if (averageTemperature > (float)TEMP_THRESHOLD) {
+							LOG_W(APP, "ALERT: Temperature is above the threshold!");
 
-							// Play square wave for 3 seconds
-							printString("Playing alert sound...\r\n");
-							PlaySquareWave(500 * (averageTemperature / 10), 3000);
+							// Alert tone plays in the background while the scan runs
+							LOG_I(APP, "Playing alert sound...");
+							PlaySquareWave((uint32_t)(averageTemperature * 50.0f), ALERT_DURATION_MS);  // 50 Hz per degree
 
-							printString("Starting Stepper Motor Scan...\r\n");
-							StepperMotor_Scan();  // Perform stepper motor scan
-							Timer5_DelayMs(5000);
+							LOG_I(SCAN, "Starting Stepper Motor Scan...");
+							StepperMotor_Scan(averageTemperature);  // Posts EVT_SCAN_DONE when finished
 					} else {
-							printString("Temperature is within safe limits.\r\n");
+							LOG_I(APP, "Temperature is within safe limits.");
+							StandbyMode();
 					}
+        break;
+    }
+
+    case EVT_SCAN_DONE:
+        StepperMotor_ShowResult();
+        SoftTimer_StartMs(&appTimer, RESULT_HOLD_MS, 0, EventLoop_PostFromTimer, EVENT_ARG(EVT_DISPLAY_DONE));
+        break;
+
+    case EVT_DISPLAY_DONE:
+        StandbyMode();
+        break;
+
+    case EVT_STANDBY_TICK: {
+						//lcd print
+						char temperature[50];
+						float standbyTemperature = BMP280_ReadTemperature();
+						PROFILE_ENTER(PROF_FORMAT);
+						Fmt_Str(Fmt_Float(temperature, standbyTemperature, 2), FONT_DEGREE "C");
+						PROFILE_EXIT(PROF_FORMAT);
+						Lcd_ShowReading("Temp", temperature);
 
-					// After the scan, enter standby mode
-					printString("Scan complete. Entering Standby Mode...\r\n");
-					StandbyMode();  // Enter standby mode
+            // Print the average temperature
+            LOG_I(TEMP, "Average Temperature: %.2f C", standbyTemperature);
+        break;
     }
 
-    return 0;
+    case EVT_SLEEP_REQUEST:
+        App_Sleep();
+        break;
+
+    case EVT_SCAN_REQUEST:
+        if (StepperMotor_Busy()) break;
+        SoftTimer_Stop(&appTimer);           // Standby refresh would overwrite the plot
+        LOG_I(SCAN, "Starting Stepper Motor Scan...");
+        StepperMotor_Scan(BMP280_ReadTemperature());   // Ends in standby, like an alert scan
+        break;
+
+    case EVT_PROFILE_DUMP:
+        Profile_Dump();
+        IsrStats_Dump();
+        break;
+
+    default:
+        break;
+    }
 }
 
 // Function to check comparator output
 uint8_t CheckComparatorOutput(void) {
-		printString("error");
+		LOG_T(TEMP, "CheckComparatorOutput");
     return (COMP_ACSTAT0_R & 0x02);  // Returns 1 if C0+ > C0-
 }
 
-// Standby mode: Update and print temperature every 2 seconds
+// Standby mode: update and print temperature every second until the
+// deep-sleep button posts EVT_SLEEP_REQUEST
 void StandbyMode(void) {
-    while (!isDeepSleepPressed) {
-        // Perform one full scan (128 samples)
-            /*
-						float sum = 0;
-            for (uint8_t i = 0; i < FILTER_SIZE; i++) {
-                float temp = BMP280_ReadTemperature();
-                sum += temp;
-                Timer5_DelayMs(10);  // Small delay between samples
-            }
-
-            float averageTemperature = sum / FILTER_SIZE;
-						*/
-						
-						//lcd print
-						char temperature[50];
-						Nokia5110_Clear();
-						sprintf(temperature, "Temp: %.2f", BMP280_ReadTemperature());
-						Nokia5110_OutString(temperature);
-
-            // Print the average temperature
-            printString("Average Temperature: ");
-            printFloat(BMP280_ReadTemperature(), 2);
-            printString(" C\r\n");
-
-        // Delay for 2 seconds
-        Timer5_DelayMs(1000);
-    }
+    // After the scan, enter standby mode
+    LOG_I(APP, "Scan complete. Entering Standby Mode...");
+    SoftTimer_StartMs(&appTimer, STANDBY_PERIOD_MS, STANDBY_PERIOD_MS,
+                      EventLoop_PostFromTimer, EVENT_ARG(EVT_STANDBY_TICK));
+    EventLoop_Post(EVT_STANDBY_TICK, 0);
 }
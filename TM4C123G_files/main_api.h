@@ -0,0 +1,30 @@
+#ifndef MAIN_API_H
+#define MAIN_API_H
+
+#include <stdint.h>
+
+// ==================== Shared Declarations ====================
+// The firmware modules are header-only and compiled into main.c. The one
+// other translation unit, Nokia5110.c, reaches them through the
+// declarations here. udma.h, atomic.h and kernel.h include this header too,
+// so a declaration that drifts from its definition fails to compile.
+
+// uDMA channel assignments (encoding 0, the reset mapping)
+#define UDMA_CH_UART0TX      9
+#define UDMA_CH_SSI0TX       11
+#define UDMA_CHCTL_ARBSIZE_4 0x00008000   // 4 transfers, as in tm4c123gh6pm.h
+
+extern uint32_t SystemCoreClock;          // Published by Clock_Init (clock.h)
+
+// Function prototypes
+uint32_t Atomic_Enter(void);              // atomic.h
+void Atomic_Exit(uint32_t state);
+void Udma_Init(void);                     // udma.h
+void Udma_ChannelInit(uint8_t channel);
+void Udma_StartToPeripheral(uint8_t channel, const void *src, volatile void *dst,
+                            uint32_t bytes, uint32_t arbSize);
+uint8_t Udma_TakeDone(uint8_t channel);
+uint8_t Kernel_Running(void);             // kernel.h
+void Kernel_Sleep(uint32_t ticks);
+
+#endif // MAIN_API_H
@@ -1,52 +1,61 @@
 #include "tm4c123gh6pm.h"
 #include <stdint.h>
-#include <stdio.h>
 #include <math.h>
+#include "profile.h"
+#include "lcd_frame.h"
+#include "gfx.h"
 
 #define LCD_WIDTH 84
 #define LCD_HEIGHT 48
 #define CENTER_X (LCD_WIDTH / 2)
 #define MAX_DISTANCE 100 // Max distance in cm for screen scaling
+#define ORIGIN_Y (LCD_HEIGHT - 1)      // Sensor at the bottom centre
+#define PLOT_RADIUS (CENTER_X - 1)     // MAX_DISTANCE in pixels; +-90 degrees still fits
 
-// Map angle (-90 to 90) to LCD x-coordinate (0 to 83)
-int mapAngleToX(int angle) {
-    return CENTER_X + (angle * LCD_WIDTH / 180);
-}
-
-// Map distance (0 to MAX_DISTANCE) to LCD y-coordinate (47 to 0)
-int mapDistanceToY(uint16_t distance) {
+// Map distance (0 to MAX_DISTANCE) to a radius in pixels
+int mapDistanceToRadius(uint16_t distance) {
     if (distance > MAX_DISTANCE) distance = MAX_DISTANCE;
-    return LCD_HEIGHT - 1 - (distance * (LCD_HEIGHT - 1) / MAX_DISTANCE);
+    return distance * PLOT_RADIUS / MAX_DISTANCE;
 }
 
-// Function to dynamically plot angles and distances
+// Radar view of a scan: range rings at half and full MAX_DISTANCE, echoes in
+// neighbouring bins joined into a contour, and a ray to the nearest echo
 void dynamicPlot(uint16_t *distances, int *angles, int count) {
-    const uint16_t NO_OBJECT_DISTANCE = MAX_DISTANCE; // Treat MAX_DISTANCE as no object
-    int objectDetected = 0;  // Flag to track if an object is currently being detected
+    int prevX = 0, prevY = 0, havePrev = 0;  // Last echo, if the previous bin had one
+    int nearest = -1;
 
-    Nokia5110_ClearBuffer(); // Clear the LCD buffer
+    Lcd_BeginFrame();        // Wait for the previous frame to be swapped out
+    PROFILE_ENTER(PROF_DYNAMIC_PLOT);
+    Nokia5110_ClearBuffer(); // Clear the back buffer
+    Gfx_Arc(CENTER_X, ORIGIN_Y, PLOT_RADIUS / 2, -90, 90, GFX_SET);
+    Gfx_Arc(CENTER_X, ORIGIN_Y, PLOT_RADIUS, -90, 90, GFX_SET);
+    Gfx_HLine(CENTER_X - 1, CENTER_X + 1, ORIGIN_Y - 1, GFX_SET);   // Sensor marker
 
     for (int i = 0; i < count; i++) {
-        int x = mapAngleToX(angles[i]);  // Map angle to x-coordinate
-        int y;
-
-        if (distances[i] <= MAX_DISTANCE) {
-            // Object detected
-            objectDetected = 1;  // Set object detected flag
-            y = mapDistanceToY(distances[i]);  // Map distance to y-coordinate
-        } else if (objectDetected) {
-            // Transition from object to no object
-            objectDetected = 0;  // Reset object detected flag
-            y = mapDistanceToY(NO_OBJECT_DISTANCE);  // Plot max distance
+        if (distances[i] > MAX_DISTANCE) {   // No object (or no echo) in this bin
+            havePrev = 0;
+            continue;
+        }
+        int x, y;
+        Gfx_PolarPoint(CENTER_X, ORIGIN_Y, angles[i], mapDistanceToRadius(distances[i]), &x, &y);
+        if (havePrev) {
+            Gfx_Line(prevX, prevY, x, y, GFX_SET);
         } else {
-            // No object, plot max distance
-            y = mapDistanceToY(NO_OBJECT_DISTANCE);
+            Gfx_Pixel(x, y, GFX_SET);
+        }
+        prevX = x;
+        prevY = y;
+        havePrev = 1;
+        if (nearest < 0 || distances[i] < distances[nearest]) {
+            nearest = i;
         }
-
-        // Plot the point
-        Nokia5110_SetPxl(y, x);
     }
+    if (nearest >= 0) {
+        Gfx_Ray(CENTER_X, ORIGIN_Y, angles[nearest], 2, mapDistanceToRadius(distances[nearest]), GFX_SET);
+    }
+
+    // Swap it in once the frame on the wire is complete (uDMA)
+    Lcd_ShowFrame();
 
-    // Display the buffer
-    Nokia5110_DisplayBuffer();
+    PROFILE_EXIT(PROF_DYNAMIC_PLOT);
 }
\ No newline at end of file
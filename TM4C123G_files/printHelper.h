@@ -2,38 +2,39 @@
 #define PRINT_HELPER_H
 
 #include <stdint.h>
+#include "profile.h"
+#include "uart0.h"
+#include "fmt.h"
 
-// Function to print a character via UART
-void OutChar(char c);
+// Function prototypes
+void printChar(char c);
+void Print_Flush(void);
+
+// Function to print a character via UART (queued; returns immediately)
+void printChar(char c) {
+    OutChar(c);
+}
+
+// Block until every queued character has been sent
+void Print_Flush(void) {
+    Uart0_Flush();
+}
 
 // Function to print a string via UART
 void printString(const char *str) {
+    PROFILE_ENTER(PROF_OUTCHAR);
     while (*str) {
-        OutChar(*str);
+        printChar(*str);
         str++;
     }
+    PROFILE_EXIT(PROF_OUTCHAR);
 }
 
 // Function to print an integer (decimal) via UART
 void printInt(uint32_t num) {
-    if (num == 0) {
-        OutChar('0');
-        return;
-    }
-
-    char buffer[10];
-    int i = 0;
-
-    // Convert the integer to string in reverse order
-    while (num > 0) {
-        buffer[i++] = (num % 10) + '0';  // Get the last digit
-        num /= 10;  // Remove the last digit
-    }
-
-    // Print the string in correct order
-    for (int j = i - 1; j >= 0; j--) {
-        OutChar(buffer[j]);
-    }
+    char buffer[11];
+    Fmt_Uint(buffer, num, 0, ' ');
+    printString(buffer);
 }
 
 // Function to print a number (currently prints decimal) via UART
@@ -41,28 +42,11 @@ void printNumber(uint32_t num) {
     printInt(num);  // Reuse printInt to print the number in decimal
 }
 
-// Function to print a float via UART
+// Function to print a float via UART, rounded to decimalPlaces digits
 void printFloat(float value, int decimalPlaces) {
-    if (value < 0) {
-        OutChar('-');    // Print negative sign for negative values
-        value = -value;  // Work with the absolute value
-    }
-
-    // Print the integer part
-    uint32_t intPart = (uint32_t)value;
-    printInt(intPart);
-
-    // Print the decimal point
-    OutChar('.');
-
-    // Calculate the fractional part
-    float fractionalPart = value - (float)intPart;
-    for (int i = 0; i < decimalPlaces; i++) {
-        fractionalPart *= 10;
-    }
-
-    // Print the fractional part as an integer
-    printInt((uint32_t)fractionalPart);
+    char buffer[24];
+    Fmt_Float(buffer, value, decimalPlaces);
+    printString(buffer);
 }
 
 #endif  // PRINT_HELPER_H
@@ -0,0 +1,132 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "TM4C123.h"
+#include <stdint.h>
+#include "atomic.h"
+
+// UART output from printHelper.h (which itself uses the profiling macros)
+void printChar(char c);
+void printString(const char *str);
+void printInt(uint32_t num);
+
+// ==================== DWT Cycle-Count Profiling ====================
+// Named zones measured with the Cortex-M4 DWT cycle counter (CYCCNT).
+// Wrap a code path in PROFILE_ENTER(zone) / PROFILE_EXIT(zone); each zone
+// accumulates call count, min, max and total cycles in a static table that
+// Profile_Dump() prints over UART0.
+//
+// Set PROFILE_ENABLED to 0 to compile every macro (and the table) out.
+// PROFILE_ENTER declares the pass's start stamp as a local, so ENTER and
+// EXIT must be in the same block. Passes of one zone from an ISR and a task
+// may overlap; each keeps its own start and Profile_Record updates the table
+// inside a critical section.
+
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 1
+#endif
+
+// Profiling zones; add new zones before PROF_ZONE_COUNT and to profileZoneNames
+typedef enum {
+    PROF_DYNAMIC_PLOT,       // dynamicPlot
+    PROF_DISPLAY_BUFFER,     // Lcd_ShowFrame: buffer swap and flush start
+    PROF_BMP280_READ,        // BMP280_ReadTemperature
+    PROF_FORMAT,             // fmt.h calls building LCD text
+    PROF_OUTCHAR,            // printString/OutChar loop
+    PROF_CONTEXT_SWITCH,     // PendSV save/restore (kernel_switch.s)
+    PROF_ZONE_COUNT
+} ProfileZone;
+
+#if PROFILE_ENABLED
+
+typedef struct {
+    uint32_t count;          // Completed enter/exit pairs
+    uint32_t min;            // Shortest pass, cycles
+    uint32_t max;            // Longest pass, cycles
+    uint64_t total;          // Sum of all passes, cycles
+} ProfileStats;
+
+static ProfileStats profileTable[PROF_ZONE_COUNT];
+
+static const char * const profileZoneNames[PROF_ZONE_COUNT] = {
+    "dynamicPlot",
+    "ShowFrame",
+    "BMP280_Read",
+    "format",
+    "OutChar",
+    "ctxSwitch",
+};
+
+#define PROFILE_ENTER(zone) uint32_t profileStart_##zone = DWT->CYCCNT
+#define PROFILE_EXIT(zone)  Profile_Record((zone), DWT->CYCCNT - profileStart_##zone)
+
+// Function prototypes
+void Profile_Init(void);
+void Profile_Reset(void);
+void Profile_Record(ProfileZone zone, uint32_t cycles);
+void Profile_Dump(void);
+
+// Enable the DWT cycle counter and clear the table
+void Profile_Init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;  // Enable trace/DWT block
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;             // Start the cycle counter
+    Profile_Reset();
+}
+
+// Clear all zone statistics
+void Profile_Reset(void) {
+    uint32_t state = Atomic_Enter();
+    for (int i = 0; i < PROF_ZONE_COUNT; i++) {
+        profileTable[i].count = 0;
+        profileTable[i].min = 0xFFFFFFFF;
+        profileTable[i].max = 0;
+        profileTable[i].total = 0;
+    }
+    Atomic_Exit(state);
+}
+
+// Add one measured pass to a zone (any context below the BASEPRI level)
+void Profile_Record(ProfileZone zone, uint32_t cycles) {
+    ProfileStats *s = &profileTable[zone];
+    uint32_t state = Atomic_Enter();   // An ISR pass may land mid-update
+    s->count++;
+    s->total += cycles;
+    if (cycles < s->min) s->min = cycles;
+    if (cycles > s->max) s->max = cycles;
+    Atomic_Exit(state);
+}
+
+// Print one line per zone that has been hit: name count min avg max
+void Profile_Dump(void) {
+    printString("zone count min avg max (cycles)\r\n");
+    for (int i = 0; i < PROF_ZONE_COUNT; i++) {
+        uint32_t state = Atomic_Enter();
+        ProfileStats s = profileTable[i];  // Copy so the line is self-consistent
+        Atomic_Exit(state);
+        if (s.count == 0) continue;
+
+        printString(profileZoneNames[i]);
+        printChar(' ');
+        printInt(s.count);
+        printChar(' ');
+        printInt(s.min);
+        printChar(' ');
+        printInt((uint32_t)(s.total / s.count));
+        printChar(' ');
+        printInt(s.max);
+        printString("\r\n");
+    }
+}
+
+#else
+
+#define PROFILE_ENTER(zone) ((void)0)
+#define PROFILE_EXIT(zone)  ((void)0)
+#define Profile_Init()      ((void)0)
+#define Profile_Reset()     ((void)0)
+#define Profile_Dump()      ((void)0)
+
+#endif // PROFILE_ENABLED
+
+#endif // PROFILE_H
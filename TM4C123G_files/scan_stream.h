@@ -0,0 +1,166 @@
+#ifndef SCAN_STREAM_H
+#define SCAN_STREAM_H
+
+#include <stdint.h>
+#include "printHelper.h"
+
+// ==================== Scan Streaming Protocol ====================
+// Sends a scan over UART0 while it runs, as COBS-framed packets:
+//
+//   0x00 COBS(payload | crc16) 0x00
+//
+// crc16 is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of the payload,
+// appended little-endian. COBS removes every 0x00 from the frame, and the
+// leading 0x00 cuts off whatever text, BLOG frame or raw scan export came
+// before it, so a receiver always starts the frame cleanly. All payload
+// fields are little-endian:
+//
+//   BEGIN  type=1 scanId:u32 startUs:u32 tempCentiC:i16 fromDeg:i16 toDeg:i16 bins:u16
+//   BIN    type=2 scanId:u32 bin:u16 angleDeg:i16 distanceCm:u16 timeUs:u32
+//   END    type=3 scanId:u32 bins:u16 detected:u8 angleDeg:i16 distanceCm:u16
+//
+// One BIN is sent as each bin completes; distanceCm 0xFFFF means no echo and
+// timeUs counts from startUs. host/scan_protocol.h decodes the same layout.
+// Call from the app task only, like every other UART0 print.
+
+#ifndef SCAN_STREAM_ENABLED
+#define SCAN_STREAM_ENABLED 1
+#endif
+
+#define SCAN_PKT_BEGIN 1
+#define SCAN_PKT_BIN   2
+#define SCAN_PKT_END   3
+
+#define SCAN_STREAM_MAX_PAYLOAD 24            // Largest packet plus CRC fits
+#define SCAN_STREAM_MAX_FRAME   (SCAN_STREAM_MAX_PAYLOAD + SCAN_STREAM_MAX_PAYLOAD / 254 + 2)
+
+#if SCAN_STREAM_ENABLED
+
+// Function prototypes
+uint16_t Crc16_Ccitt(const uint8_t *data, uint32_t len);
+uint32_t Cobs_Encode(const uint8_t *src, uint32_t len, uint8_t *dst);
+void ScanStream_Begin(uint32_t scanId, uint32_t startUs, float temperature,
+                      int16_t fromDeg, int16_t toDeg, uint16_t bins);
+void ScanStream_Bin(uint32_t scanId, uint16_t bin, int16_t angleDeg,
+                    uint16_t distanceCm, uint32_t timeUs);
+void ScanStream_End(uint32_t scanId, uint16_t bins, uint8_t detected,
+                    int16_t angleDeg, uint16_t distanceCm);
+
+// CRC-16/CCITT-FALSE, bitwise (packets are short)
+uint16_t Crc16_Ccitt(const uint8_t *data, uint32_t len) {
+    uint16_t crc = 0xFFFF;
+    while (len--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// Consistent Overhead Byte Stuffing of len bytes into dst (at most
+// len + len / 254 + 1 bytes, no delimiter). Returns the encoded length.
+uint32_t Cobs_Encode(const uint8_t *src, uint32_t len, uint8_t *dst) {
+    uint8_t *code = dst;                        // Where the current block's code goes
+    uint8_t *out = dst + 1;
+    uint8_t run = 1;
+
+    for (uint32_t i = 0; i < len; i++) {
+        if (src[i] == 0) {
+            *code = run;
+            code = out++;
+            run = 1;
+        } else {
+            *out++ = src[i];
+            if (++run == 0xFF) {                // Full block: start another
+                *code = run;
+                code = out++;
+                run = 1;
+            }
+        }
+    }
+    *code = run;
+    return out - dst;
+}
+
+static uint8_t *ScanStream_Put16(uint8_t *p, uint16_t v) {
+    *p++ = v;
+    *p++ = v >> 8;
+    return p;
+}
+
+static uint8_t *ScanStream_Put32(uint8_t *p, uint32_t v) {
+    p = ScanStream_Put16(p, v);
+    return ScanStream_Put16(p, v >> 16);
+}
+
+// Append the CRC, encode and queue one frame
+static void ScanStream_Send(uint8_t *payload, uint8_t *end) {
+    uint8_t frame[SCAN_STREAM_MAX_FRAME];
+    uint32_t len = end - payload;
+
+    end = ScanStream_Put16(end, Crc16_Ccitt(payload, len));
+    len = Cobs_Encode(payload, len + 2, frame);
+    printChar(0);                               // End any partial frame before us
+    for (uint32_t i = 0; i < len; i++) {
+        printChar(frame[i]);
+    }
+    printChar(0);                               // Frame delimiter
+}
+
+// A scan has started
+void ScanStream_Begin(uint32_t scanId, uint32_t startUs, float temperature,
+                      int16_t fromDeg, int16_t toDeg, uint16_t bins) {
+    uint8_t pkt[SCAN_STREAM_MAX_PAYLOAD];
+    uint8_t *p = pkt;
+    float centi = temperature * 100.0f;
+
+    *p++ = SCAN_PKT_BEGIN;
+    p = ScanStream_Put32(p, scanId);
+    p = ScanStream_Put32(p, startUs);
+    p = ScanStream_Put16(p, (int16_t)(centi + (centi < 0.0f ? -0.5f : 0.5f)));
+    p = ScanStream_Put16(p, fromDeg);
+    p = ScanStream_Put16(p, toDeg);
+    p = ScanStream_Put16(p, bins);
+    ScanStream_Send(pkt, p);
+}
+
+// One bin is final
+void ScanStream_Bin(uint32_t scanId, uint16_t bin, int16_t angleDeg,
+                    uint16_t distanceCm, uint32_t timeUs) {
+    uint8_t pkt[SCAN_STREAM_MAX_PAYLOAD];
+    uint8_t *p = pkt;
+
+    *p++ = SCAN_PKT_BIN;
+    p = ScanStream_Put32(p, scanId);
+    p = ScanStream_Put16(p, bin);
+    p = ScanStream_Put16(p, angleDeg);
+    p = ScanStream_Put16(p, distanceCm);
+    p = ScanStream_Put32(p, timeUs);
+    ScanStream_Send(pkt, p);
+}
+
+// The scan is complete, with its object detection result
+void ScanStream_End(uint32_t scanId, uint16_t bins, uint8_t detected,
+                    int16_t angleDeg, uint16_t distanceCm) {
+    uint8_t pkt[SCAN_STREAM_MAX_PAYLOAD];
+    uint8_t *p = pkt;
+
+    *p++ = SCAN_PKT_END;
+    p = ScanStream_Put32(p, scanId);
+    p = ScanStream_Put16(p, bins);
+    *p++ = detected;
+    p = ScanStream_Put16(p, angleDeg);
+    p = ScanStream_Put16(p, distanceCm);
+    ScanStream_Send(pkt, p);
+}
+
+#else
+
+#define ScanStream_Begin(scanId, startUs, temperature, fromDeg, toDeg, bins) ((void)0)
+#define ScanStream_Bin(scanId, bin, angleDeg, distanceCm, timeUs)            ((void)0)
+#define ScanStream_End(scanId, bins, detected, angleDeg, distanceCm)         ((void)0)
+
+#endif // SCAN_STREAM_ENABLED
+
+#endif // SCAN_STREAM_H
@@ -0,0 +1,240 @@
+#ifndef SOFT_TIMER_H
+#define SOFT_TIMER_H
+
+#include "tm4c123gh6pm.h"
+#include "TM4C123.h"
+#include <stdint.h>
+#include "clock.h"
+#include "kernel.h"
+#include "atomic.h"
+
+// ==================== Software Timer Service ====================
+// Timer4A runs free (32-bit, periodic, counting up) and is never reloaded.
+// Every software timer is a node in a delta list sorted by expiry: each node
+// stores the ticks between its own expiry and the expiry of the node before
+// it, so the ISR only ever looks at the list head. The match register
+// (TAMATCHR) is programmed with the absolute tick of the head, so the CPU is
+// only interrupted when something is actually due.
+//
+// Callbacks run inside TIMER4A_Handler: keep them short (set a flag, toggle a
+// pin, post an event) and never block in them.
+
+#define SOFTTIMER_TICKS_PER_US Clock_TicksPerUs()   // Timer4 runs at the system clock
+#define SOFTTIMER_TICKS_PER_MS (SOFTTIMER_TICKS_PER_US * 1000)
+#define SOFTTIMER_MIN_TICKS    64          // Closer than this is handled as already due
+
+typedef void (*SoftTimerCallback)(void *arg);
+
+typedef struct SoftTimer {
+    struct SoftTimer *next;      // Next timer in the delta list
+    uint32_t delta;              // Ticks after the expiry of the previous node
+    uint32_t period;             // Reload in ticks, 0 for one-shot
+    SoftTimerCallback callback;  // Called from TIMER4A_Handler on expiry
+    void *arg;                   // Passed to callback
+    volatile uint8_t active;     // 1 while linked into the list
+} SoftTimer;
+
+static SoftTimer *softTimerHead = 0;   // Earliest timer
+static uint32_t softTimerBase = 0;     // Absolute tick the head delta is relative to
+
+// Function prototypes
+void SoftTimer_Init(void);
+uint32_t SoftTimer_Now(void);
+void SoftTimer_Start(SoftTimer *timer, uint32_t delayTicks, uint32_t periodTicks,
+                     SoftTimerCallback callback, void *arg);
+void SoftTimer_StartMs(SoftTimer *timer, uint32_t delayMs, uint32_t periodMs,
+                       SoftTimerCallback callback, void *arg);
+void SoftTimer_Stop(SoftTimer *timer);
+void SoftTimer_DelayMs(uint32_t ms);
+void TIMER4A_Handler(void);
+
+// Initialize Timer4A as the free-running time source
+void SoftTimer_Init(void) {
+    SYSCTL_RCGCTIMER_R |= 0x10;                 // Enable Timer4 clock
+    while ((SYSCTL_PRTIMER_R & 0x10) == 0);     // Wait for Timer4 to be ready
+
+    TIMER4_CTL_R &= ~0x01;                      // Disable Timer4A during configuration
+    TIMER4_CFG_R = 0x00000000;                  // 32-bit mode
+    TIMER4_TAMR_R = 0x02 | TIMER_TAMR_TACDIR | TIMER_TAMR_TAMIE; // Periodic, count up, match interrupt
+    TIMER4_TAILR_R = 0xFFFFFFFF;                // Wrap at the full 32-bit range
+    TIMER4_TAMATCHR_R = 0xFFFFFFFF;             // No timer armed yet
+    TIMER4_ICR_R = TIMER_ICR_TAMCINT;           // Clear match flag
+    TIMER4_IMR_R = 0;                           // Match interrupt stays masked while the list is empty
+    TIMER4_CTL_R |= 0x01;                       // Start counting
+
+    NVIC_EnableIRQ(TIMER4A_IRQn);
+}
+
+// Current value of the free-running counter
+uint32_t SoftTimer_Now(void) {
+    return TIMER4_TAR_R;
+}
+
+// Link a timer into the delta list, rel ticks after softTimerBase.
+// Must be called with interrupts disabled.
+static void SoftTimer_Insert(SoftTimer *timer, uint32_t rel) {
+    SoftTimer *prev = 0;
+    SoftTimer *node = softTimerHead;
+
+    // Equal expiries keep insertion order (>=), so callbacks fire FIFO
+    while (node && rel >= node->delta) {
+        rel -= node->delta;
+        prev = node;
+        node = node->next;
+    }
+
+    timer->delta = rel;
+    timer->next = node;
+    timer->active = 1;
+    if (node) {
+        node->delta -= rel;
+    }
+    if (prev) {
+        prev->next = timer;
+    } else {
+        softTimerHead = timer;
+    }
+}
+
+// Remove a timer from the list, handing its delta to its successor.
+// Must be called with interrupts disabled.
+static void SoftTimer_Unlink(SoftTimer *timer) {
+    SoftTimer *prev = 0;
+    SoftTimer *node = softTimerHead;
+
+    while (node && node != timer) {
+        prev = node;
+        node = node->next;
+    }
+    if (!node) {
+        return;
+    }
+    if (node->next) {
+        node->next->delta += node->delta;
+    }
+    if (prev) {
+        prev->next = node->next;
+    } else {
+        softTimerHead = node->next;       // Base is unchanged; successor absorbed our delta
+    }
+    node->next = 0;
+    node->active = 0;
+}
+
+// Program the match register for the list head, or mask the interrupt
+// when nothing is pending. If the head is already due (or too close to be
+// caught by the match compare) the interrupt is pended by software instead.
+static void SoftTimer_Rearm(void) {
+    if (!softTimerHead) {
+        TIMER4_IMR_R &= ~TIMER_IMR_TAMIM;
+        return;
+    }
+
+    uint32_t due = softTimerBase + softTimerHead->delta;
+    TIMER4_TAMATCHR_R = due;
+    TIMER4_ICR_R = TIMER_ICR_TAMCINT;
+    TIMER4_IMR_R |= TIMER_IMR_TAMIM;
+
+    if ((int32_t)(due - SoftTimer_Now()) < SOFTTIMER_MIN_TICKS) {
+        NVIC_SetPendingIRQ(TIMER4A_IRQn);
+    }
+}
+
+// Start (or restart) a timer: first expiry after delayTicks, then every
+// periodTicks (0 = one-shot). The timer struct must stay alive while active.
+void SoftTimer_Start(SoftTimer *timer, uint32_t delayTicks, uint32_t periodTicks,
+                     SoftTimerCallback callback, void *arg) {
+    uint32_t state = Atomic_Enter();
+
+    if (timer->active) {
+        SoftTimer_Unlink(timer);
+    }
+    timer->period = periodTicks;
+    timer->callback = callback;
+    timer->arg = arg;
+
+    uint32_t now = SoftTimer_Now();
+    if (!softTimerHead) {
+        softTimerBase = now;               // Empty list: rebase on the current tick
+    }
+    SoftTimer_Insert(timer, (now - softTimerBase) + delayTicks);
+    SoftTimer_Rearm();
+
+    Atomic_Exit(state);
+}
+
+// Millisecond convenience wrapper around SoftTimer_Start
+void SoftTimer_StartMs(SoftTimer *timer, uint32_t delayMs, uint32_t periodMs,
+                       SoftTimerCallback callback, void *arg) {
+    SoftTimer_Start(timer, delayMs * SOFTTIMER_TICKS_PER_MS, periodMs * SOFTTIMER_TICKS_PER_MS,
+                    callback, arg);
+}
+
+// Stop a timer; safe to call on a timer that is not running
+void SoftTimer_Stop(SoftTimer *timer) {
+    uint32_t state = Atomic_Enter();
+
+    if (timer->active) {
+        SoftTimer_Unlink(timer);
+        SoftTimer_Rearm();
+    }
+
+    Atomic_Exit(state);
+}
+
+// Timer4A match ISR: run every callback that is due, oldest first
+void TIMER4A_Handler(void) {
+    TIMER4_ICR_R = TIMER_ICR_TAMCINT;   // Clear match flag
+
+    while (softTimerHead && (SoftTimer_Now() - softTimerBase) >= softTimerHead->delta) {
+        SoftTimer *timer = softTimerHead;
+
+        softTimerBase += timer->delta;  // Base moves to the expiry being serviced
+        softTimerHead = timer->next;
+        timer->next = 0;
+        timer->active = 0;
+
+        if (timer->period) {
+            // Reload relative to the nominal expiry, not the ISR time, so
+            // periodic timers do not accumulate service jitter
+            SoftTimer_Insert(timer, timer->period);
+        }
+        if (timer->callback) {
+            timer->callback(timer->arg);
+        }
+    }
+
+    SoftTimer_Rearm();
+}
+
+// One-shot callback used by SoftTimer_DelayMs
+static void SoftTimer_SetFlag(void *arg) {
+    *(volatile uint8_t *)arg = 1;
+}
+
+// Sleep for ms milliseconds. The core waits in WFI instead of polling a
+// timer flag, so interrupts are serviced at full speed during the delay.
+// From a task the delay blocks in the kernel so lower-priority tasks run.
+void SoftTimer_DelayMs(uint32_t ms) {
+    SoftTimer timer = {0};
+    volatile uint8_t expired = 0;
+
+    if (Kernel_Running()) {
+        Kernel_Sleep(KERNEL_MS_TO_TICKS(ms) + 1);   // +1: the first tick may be almost due
+        return;
+    }
+
+    SoftTimer_StartMs(&timer, ms, 0, SoftTimer_SetFlag, (void *)&expired);
+    while (!expired) {
+        // Check-then-sleep with interrupts masked: a pending interrupt still
+        // wakes WFI, so an expiry between the check and WFI is not lost
+        __disable_irq();
+        if (!expired) {
+            __WFI();
+        }
+        __enable_irq();
+    }
+    SoftTimer_Stop(&timer);
+}
+
+#endif // SOFT_TIMER_H
@@ -0,0 +1,73 @@
+#ifndef SPSC_H
+#define SPSC_H
+
+#include "TM4C123.h"
+#include <stdint.h>
+#include <string.h>
+
+// ==================== Lock-Free SPSC Ring Buffer ====================
+// Single producer / single consumer queue of fixed-size records, used to
+// hand samples from an ISR to the main loop without losing or re-reading
+// them. No locks and no interrupt masking: the producer only writes head,
+// the consumer only writes tail, and data memory barriers order the record
+// copy against the index update.
+//
+// head and tail are free-running counters; the slot is counter & mask, so
+// the capacity must be a power of two. A full ring rejects the new record
+// and counts it in dropped, so the consumer can tell that it fell behind.
+
+typedef struct {
+    uint8_t *buffer;            // capacity * elementSize bytes
+    uint32_t elementSize;       // Bytes per record
+    uint32_t mask;              // capacity - 1
+    volatile uint32_t head;     // Records ever pushed (producer only)
+    volatile uint32_t tail;     // Records ever popped (consumer only)
+    volatile uint32_t dropped;  // Pushes rejected because the ring was full (producer only)
+} SpscRing;
+
+// Define a ring named name holding capacity records of type
+#define SPSC_DEFINE(name, type, capacity)                                   \
+    _Static_assert((capacity) > 0 && ((capacity) & ((capacity) - 1)) == 0, \
+                   #name ": SPSC capacity must be a power of two");         \
+    static type name##Storage[(capacity)];                                  \
+    static SpscRing name = { (uint8_t *)name##Storage, sizeof(type), (capacity) - 1, 0, 0, 0 }
+
+// Function prototypes
+uint8_t Spsc_Push(SpscRing *ring, const void *item);
+uint8_t Spsc_Pop(SpscRing *ring, void *item);
+uint32_t Spsc_Count(const SpscRing *ring);
+
+// Producer: append a record. Returns 0 (and counts a drop) if the ring is full.
+uint8_t Spsc_Push(SpscRing *ring, const void *item) {
+    uint32_t head = ring->head;
+
+    if (head - ring->tail > ring->mask) {
+        ring->dropped++;
+        return 0;
+    }
+    memcpy(&ring->buffer[(head & ring->mask) * ring->elementSize], item, ring->elementSize);
+    __DMB();                    // Record must be visible before the new head
+    ring->head = head + 1;
+    return 1;
+}
+
+// Consumer: remove the oldest record into item. Returns 0 if the ring is empty.
+uint8_t Spsc_Pop(SpscRing *ring, void *item) {
+    uint32_t tail = ring->tail;
+
+    if (tail == ring->head) {
+        return 0;
+    }
+    __DMB();                    // Read the record only after seeing the head
+    memcpy(item, &ring->buffer[(tail & ring->mask) * ring->elementSize], ring->elementSize);
+    __DMB();                    // Finish reading before the slot is released
+    ring->tail = tail + 1;
+    return 1;
+}
+
+// Records currently queued (a snapshot; either side may move it)
+uint32_t Spsc_Count(const SpscRing *ring) {
+    return ring->head - ring->tail;
+}
+
+#endif // SPSC_H
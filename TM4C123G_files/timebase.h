@@ -0,0 +1,82 @@
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include "tm4c123gh6pm.h"
+#include "TM4C123.h"
+#include <stdint.h>
+#include "clock.h"
+
+// ==================== 64-bit Monotonic Timebase ====================
+// Wide Timer 1A counts up through the full 32-bit range at the system clock
+// (clock.h).
+// Its time-out interrupt extends the count with a 32-bit high word kept in
+// RAM, giving a 64-bit tick count that never wraps in practice.
+//
+// Timebase_NowTicks() is lock-free: it never masks interrupts and may be
+// called from any context, including ISRs that preempt the overflow handler
+// or code running with interrupts disabled.
+
+#define TIMEBASE_TICKS_PER_US (CLOCK_HZ / 1000000)   // Compile-time: the 64-bit divide is by a constant
+
+static volatile uint32_t timebaseHigh = 0;   // Upper 32 bits of the tick count
+
+// Function prototypes
+void Timebase_Init(void);
+uint64_t Timebase_NowTicks(void);
+uint64_t Timebase_NowUs(void);
+void WTIMER1A_Handler(void);
+
+// Initialize Wide Timer 1A as a free-running 32-bit up-counter
+void Timebase_Init(void) {
+    SYSCTL_RCGCWTIMER_R |= 0x02;                // Enable Wide Timer 1 clock
+    while ((SYSCTL_PRWTIMER_R & 0x02) == 0);    // Wait for Wide Timer 1 to be ready
+
+    WTIMER1_CTL_R &= ~0x01;                     // Disable Timer 1A during configuration
+    WTIMER1_CFG_R = 0x04;                       // 32-bit (half-width) mode
+    WTIMER1_TAMR_R = 0x02 | TIMER_TAMR_TACDIR;  // Periodic, count up
+    WTIMER1_TAILR_R = 0xFFFFFFFF;               // Wrap at the full 32-bit range
+    WTIMER1_ICR_R = TIMER_ICR_TATOCINT;         // Clear time-out flag
+    WTIMER1_IMR_R = TIMER_IMR_TATOIM;           // Interrupt on wrap
+    timebaseHigh = 0;
+    WTIMER1_CTL_R |= 0x01;                      // Start counting
+
+    NVIC_EnableIRQ(WTIMER1A_IRQn);
+}
+
+// 64-bit tick count since Timebase_Init
+uint64_t Timebase_NowTicks(void) {
+    uint32_t high, low, wrapped;
+
+    // Retry if the overflow ISR ran while we were reading
+    do {
+        high = timebaseHigh;
+        low = WTIMER1_TAV_R;
+        wrapped = WTIMER1_RIS_R & TIMER_RIS_TATORIS;
+    } while (high != timebaseHigh);
+
+    // A wrap that has happened but not been serviced yet (interrupts masked,
+    // or we preempted the ISR). A small low word means it belongs to this read.
+    if (wrapped && low < 0x80000000) {
+        high++;
+    }
+    return ((uint64_t)high << 32) | low;
+}
+
+// Microseconds since Timebase_Init
+uint64_t Timebase_NowUs(void) {
+    return Timebase_NowTicks() / TIMEBASE_TICKS_PER_US;
+}
+
+// Wide Timer 1A time-out ISR: extend the count into the high word
+void WTIMER1A_Handler(void) {
+    // Clear the flag and bump the high word as one step, so a reader that
+    // preempts this ISR never sees the flag and the new high word together.
+    // PRIMASK rather than Atomic_Enter: the echo capture ISR reads the
+    // timebase and runs above the BASEPRI level.
+    __disable_irq();
+    WTIMER1_ICR_R = TIMER_ICR_TATOCINT;
+    timebaseHigh++;
+    __enable_irq();
+}
+
+#endif // TIMEBASE_H
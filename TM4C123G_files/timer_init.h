@@ -5,8 +5,6 @@
 #include "TM4C123.h"
 #include <stdint.h>
 
-extern volatile uint8_t isDeepSleepPressed;
-
 // ==================== Timer Initialization and Configuration Template ====================
 
 // General-purpose timer initialization function templates are provided for all timers (Timer0-Timer5).
@@ -128,7 +126,7 @@ void Timer4_Init(void) {
     TIMER4->CTL &= ~0x01;               // Disable Timer4 during configuration
     TIMER4->CFG = 0x00000000;           // Configure as 32-bit timer
     TIMER4->TAMR = 0x02;                // Periodic mode
-    TIMER4->TAILR = 16000000 - 1;       // Load value for 1-second interval (assuming 16 MHz clock)
+    TIMER4->TAILR = SystemCoreClock - 1; // Load value for 1-second interval
     TIMER4->IMR = 0x01;                 // Enable timeout interrupt
     NVIC_EnableIRQ(TIMER4A_IRQn);       // Enable Timer4A interrupt in NVIC
     TIMER4->CTL |= 0x01;                // Enable Timer4
@@ -146,40 +144,9 @@ void Timer5_Init(void) {
 }
 
 
-// Function to create a delay in milliseconds using Timer0
-// Example delay function for creating a delay in milliseconds using Timer0.
-// Assumes a 16 MHz system clock and uses a periodic timer for delay.
-static void Timer5_DelayMs(uint32_t delay) {
-    uint32_t ticks = delay * 16000; // Assuming 16 MHz system clock
-    TIMER5_TAILR_R = ticks - 1;    // Load the calculated ticks into Timer0
-    TIMER5_ICR_R = 0x01;           // Clear timeout flag
-    TIMER5_CTL_R |= 0x01;          // Start Timer0
-
-    // Poll the timeout flag to check if the timer has finished
-    while ((TIMER5_RIS_R & 0x01) == 0){
-			if(isDeepSleepPressed){
-				break;
-			}
-		} // Wait for timeout flag to set
-
-    TIMER5_ICR_R = 0x01; // Clear timeout flag again
-}
-
-static void Timer5_DelayUs(uint32_t delay) {
-    uint32_t ticks = delay * 16; // Assuming 16 MHz system clock
-    TIMER5_TAILR_R = ticks - 1;    // Load the calculated ticks into Timer0
-    TIMER5_ICR_R = 0x01;           // Clear timeout flag
-    TIMER5_CTL_R |= 0x01;          // Start Timer0
-
-    // Poll the timeout flag to check if the timer has finished
-    while ((TIMER5_RIS_R & 0x01) == 0){
-			if(isDeepSleepPressed){
-				break;
-			}
-		} // Wait for timeout flag to set
-
-    TIMER5_ICR_R = 0x01; // Clear timeout flag again
-}
+// Millisecond delays: use SoftTimer_DelayMs() from soft_timer.h, which sleeps
+// on the Timer4 software timer service instead of spinning on TIMER5_RIS_R.
+// Microsecond delays: Timer5_DelayUs() in timer_init.s.
 
 // ==================== SysTick (Disabled by Default) ====================
 /*
@@ -1,8 +1,7 @@
     AREA Timer5Code, CODE, READONLY
     EXPORT Timer5_Init
     EXPORT Timer5_DelayUs
-    EXPORT Timer5_DelayMs
-    EXTERN isDeepSleepPressed   ; Declare external variable from main.c
+    IMPORT SystemCoreClock       ; Published by Clock_Init (clock.h)
 
 ; ==================== Timer5 Initialization ====================
 Timer5_Init
@@ -39,15 +38,17 @@ WaitReady
 
 ; ==================== Timer5 Delay in Microseconds ====================
 Timer5_DelayUs
-    PUSH    {R4, R5, R6, LR}     ; Save registers
+    PUSH    {R4, R5, LR}         ; Save registers
 
     LDR     R1, =0x40035028      ; TIMER5_TAILR_R
     LDR     R2, =0x40035024      ; TIMER5_ICR_R
     LDR     R3, =0x4003500C      ; TIMER5_CTL_R
     LDR     R4, =0x4003501C      ; TIMER5_RIS_R
-    LDR     R6, =isDeepSleepPressed  ; Load address of isDeepSleepPressed
 
-    MOV     R5, #16              ; Load 16 into R5
+    LDR     R5, =SystemCoreClock
+    LDR     R5, [R5]             ; Core clock in Hz
+    LDR     R12, =1000000
+    UDIV    R5, R5, R12          ; Ticks per microsecond
     MUL     R0, R0, R5           ; Convert microseconds to ticks
     SUB     R0, R0, #1
     STR     R0, [R1]             ; Load value into TIMER5_TAILR_R
@@ -62,29 +63,16 @@ Timer5_DelayUs
 WaitForTimeout
     LDR     R0, [R4]             ; Read TIMER5_RIS_R
     TST     R0, #1
-    BNE     ClearTimeoutFlag     ; If timeout flag is set, clear it
-
-    ; Check if isDeepSleepPressed is set
-    LDRB    R0, [R6]             ; Load the value of isDeepSleepPressed
-    CMP     R0, #1               ; Compare with 1
-    BEQ     ExitDelay            ; Exit if isDeepSleepPressed is high
-
-    B       WaitForTimeout       ; Otherwise, continue waiting
+    BEQ     WaitForTimeout       ; Keep waiting until the timeout flag is set
+                                 ; (microsecond delays are not cancellable)
 
-ClearTimeoutFlag
     MOV     R0, #1
     STR     R0, [R2]             ; Clear timeout flag
 
-ExitDelay
-    POP     {R4, R5, R6, PC}     ; Restore registers and return
-
-; ==================== Timer5 Delay in Milliseconds ====================
-Timer5_DelayMs
-    PUSH    {R4, R5, LR}         ; Save registers
+    POP     {R4, R5, PC}         ; Restore registers and return
 
-    MOV     R5, #1000            ; Load 1000 into R5
-    MUL     R0, R0, R5           ; Convert milliseconds to microseconds
-    BL      Timer5_DelayUs       ; Call microsecond delay
-    POP     {R4, R5, PC}         ; Restore and return
+; Millisecond delays live in soft_timer.h (SoftTimer_DelayMs): they sleep in
+; WFI on the Timer4 software timer service instead of polling TIMER5_RIS_R.
+; Timer5_DelayUs is kept only for the short trigger-pulse timings.
 
     END
@@ -0,0 +1,261 @@
+#ifndef UART0_H
+#define UART0_H
+
+#include "tm4c123gh6pm.h"
+#include "TM4C123.h"
+#include <stdint.h>
+#include "spsc.h"
+#include "kernel.h"
+#include "atomic.h"
+#include "udma.h"
+
+// ==================== UART0 Interrupt-Driven Driver ====================
+// UART0 on PA0/PA1 (the debug USB COM port), 8N1. Uart0_Init() configures
+// it once; after that OutChar() only appends to a TX ring and returns.
+// UART0_Handler moves bytes from the ring into the 16-byte hardware FIFO
+// whenever the FIFO drains to 1/8, and masks itself when the ring is empty.
+//
+// When the ring is full, OutChar() called from a task sleeps until there is
+// room, so long replies (console "stats") arrive whole. Anywhere it cannot
+// sleep (an ISR, a critical section, before Kernel_Start) the character is
+// dropped and counted (Uart0_Dropped, console "stats" uart_tx_dropped).
+// Uart0_Flush() waits for everything queued to leave the wire, e.g. before
+// deep sleep.
+//
+// The ring is a single-producer SPSC ring, so OutChar() makes every caller
+// that one producer by pushing inside a critical section: tasks and ISRs may
+// all print. The exception is the priority-0 echo capture, which critical
+// sections do not mask; it must not print.
+//
+// Receive is interrupt driven too: UART0_Handler drains the RX FIFO (at 1/4
+// full or on the receive time-out) and hands each good byte to the handler
+// set with Uart0_SetRxHandler(), in ISR context. Bytes with framing, parity,
+// break or overrun errors are counted and dropped.
+//
+// Uart0_Export() sends a RAM region to the TX FIFO by uDMA (channel 9) with
+// no copy, in chunks of UDMA_MAX_TRANSFER bytes. It starts once the text
+// queued before it has gone out; text queued meanwhile follows it. The
+// region must stay untouched until the completion callback runs (from
+// UART0_Handler, so it may post events or kernel semaphores).
+
+#ifndef UART0_BAUD
+#define UART0_BAUD 115200          // Default rate; anything up to 1000000
+#endif
+
+#define UART0_TX_RING_SIZE 1024    // Must be a power of two
+
+SPSC_DEFINE(uart0TxRing, char, UART0_TX_RING_SIZE);
+
+typedef enum {
+    UART0_EXPORT_IDLE,
+    UART0_EXPORT_PENDING,          // Waiting for the ring to drain
+    UART0_EXPORT_ACTIVE            // uDMA owns the TX FIFO
+} Uart0ExportState;
+
+static volatile uint8_t uart0ExportState = UART0_EXPORT_IDLE;
+static const uint8_t *uart0ExportNext;     // Next chunk to hand to the uDMA
+static uint32_t uart0ExportLeft;           // Bytes not yet handed to the uDMA
+static UdmaCallback uart0ExportDone;
+static void *uart0ExportArg;
+
+typedef void (*Uart0RxHandler)(char c);
+
+static Uart0RxHandler uart0RxHandler;      // Called from UART0_Handler
+static volatile uint32_t uart0RxErrors = 0;
+
+// Function prototypes
+void Uart0_Init(uint32_t baud);
+void Uart0_SetBaud(uint32_t baud);
+void OutChar(char c);
+uint32_t Uart0_Dropped(void);
+uint8_t Uart0_Export(const void *data, uint32_t bytes, UdmaCallback done, void *arg);
+uint8_t Uart0_ExportBusy(void);
+void Uart0_SetRxHandler(Uart0RxHandler handler);
+uint32_t Uart0_RxErrors(void);
+void Uart0_Flush(void);
+void UART0_Handler(void);
+
+// Enable UART0 on PA0 (Rx) / PA1 (Tx) at baud
+void Uart0_Init(uint32_t baud) {
+    SYSCTL_RCGCUART_R |= 0x01;                  // Enable UART0 clock
+    SYSCTL_RCGCGPIO_R |= 0x01;                  // Enable Port A clock
+    while ((SYSCTL_PRUART_R & 0x01) == 0);      // Wait for UART0 to be ready
+    while ((SYSCTL_PRGPIO_R & 0x01) == 0);      // Wait for Port A to be ready
+
+    GPIO_PORTA_AMSEL_R &= ~0x03;                // Disable analog on PA0, PA1
+    GPIO_PORTA_AFSEL_R |= 0x03;                 // Alternate function on PA0, PA1
+    GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R & ~0x000000FF) | 0x00000011; // U0Rx, U0Tx
+    GPIO_PORTA_DEN_R |= 0x03;                   // Digital enable PA0, PA1
+
+    UART0_CTL_R = 0;                            // Disable UART0 while configuring
+    UART0_CC_R = 0;                             // Clock from the system clock
+    Uart0_SetBaud(baud);
+    UART0_IFLS_R = UART_IFLS_TX1_8 | UART_IFLS_RX2_8;   // TX at <= 1/8 full, RX at >= 1/4 full
+    UART0_ICR_R = UART_ICR_RXIC | UART_ICR_RTIC | UART_ICR_TXIC;
+    UART0_IM_R = UART_IM_RXIM | UART_IM_RTIM;   // TX interrupt unmasked only while there is data
+    UART0_CTL_R |= UART_CTL_UARTEN | UART_CTL_TXE | UART_CTL_RXE;
+
+    Udma_Init();
+    Udma_ChannelInit(UDMA_CH_UART0TX);
+
+    NVIC_EnableIRQ(UART0_IRQn);
+}
+
+// Program the divisor for baud. Above SystemCoreClock / 16 the UART runs in
+// high-speed mode (8x oversampling), which reaches 1 Mbaud at 16 MHz.
+// LCRH is written last, as the datasheet requires, to latch the divisor.
+void Uart0_SetBaud(uint32_t baud) {
+    uint32_t enabled = UART0_CTL_R & UART_CTL_UARTEN;
+    uint32_t div64;                             // Divisor * 64 (6 fractional bits)
+
+    Uart0_Flush();
+    UART0_CTL_R &= ~UART_CTL_UARTEN;
+
+    if (baud * 16 > SystemCoreClock) {
+        UART0_CTL_R |= UART_CTL_HSE;            // Divide by 8
+        div64 = (SystemCoreClock * 8 + baud / 2) / baud;
+    } else {
+        UART0_CTL_R &= ~UART_CTL_HSE;           // Divide by 16
+        div64 = (SystemCoreClock * 4 + baud / 2) / baud;
+    }
+    UART0_IBRD_R = div64 >> 6;
+    UART0_FBRD_R = div64 & 0x3F;
+    UART0_LCRH_R = UART_LCRH_WLEN_8 | UART_LCRH_FEN;   // 8N1, FIFOs on
+
+    UART0_CTL_R |= enabled;
+}
+
+// Hand the next export chunk to the uDMA
+static void Uart0_ExportChunk(void) {
+    uint32_t n = (uart0ExportLeft > UDMA_MAX_TRANSFER) ? UDMA_MAX_TRANSFER : uart0ExportLeft;
+
+    Udma_StartToPeripheral(UDMA_CH_UART0TX, uart0ExportNext, &UART0_DR_R, n, UDMA_CHCTL_ARBSIZE_4);
+    uart0ExportNext += n;
+    uart0ExportLeft -= n;
+}
+
+// Move queued bytes into the TX FIFO until it is full or the ring is empty,
+// then start a pending export. Call with UART0_Handler unable to run
+// (inside the ISR or a critical section).
+static void Uart0_FillFifo(void) {
+    char c;
+
+    if (uart0ExportState == UART0_EXPORT_ACTIVE) {
+        UART0_IM_R &= ~UART_IM_TXIM;            // Ring waits for the export
+        return;
+    }
+    while (!(UART0_FR_R & UART_FR_TXFF) && Spsc_Pop(&uart0TxRing, &c)) {
+        UART0_DR_R = c;
+    }
+    if (Spsc_Count(&uart0TxRing)) {
+        UART0_IM_R |= UART_IM_TXIM;             // More to send when the FIFO drains
+    } else {
+        UART0_IM_R &= ~UART_IM_TXIM;
+        if (uart0ExportState == UART0_EXPORT_PENDING) {
+            uart0ExportState = UART0_EXPORT_ACTIVE;
+            UART0_DMACTL_R |= UART_DMACTL_TXDMAE;
+            Uart0_ExportChunk();
+        }
+    }
+}
+
+// Nonzero if the caller is a task that may sleep (not an ISR or critical section)
+static uint8_t Uart0_CanSleep(void) {
+    return __get_IPSR() == 0 && __get_BASEPRI() == 0 && Kernel_Running();
+}
+
+// Queue one character for transmission. A task waits for room in the ring;
+// other callers never block.
+void OutChar(char c) {
+    uint32_t state;
+
+    if (Uart0_CanSleep()) {
+        while (Spsc_Count(&uart0TxRing) > uart0TxRing.mask) {
+            Kernel_Sleep(1);                    // UART0_Handler drains ~11 bytes/ms at 115200
+        }
+    }
+    state = Atomic_Enter();                     // One producer at a time
+    Spsc_Push(&uart0TxRing, &c);                // Counts a drop if the ring is full
+    if (!(UART0_IM_R & UART_IM_TXIM) && uart0ExportState == UART0_EXPORT_IDLE) {
+        Uart0_FillFifo();                       // Transmitter idle: start it
+    }
+    Atomic_Exit(state);
+}
+
+// Send bytes bytes at data by uDMA; done(arg) runs when the last byte is in
+// the FIFO. Returns 0 (and does nothing) if an export is already under way.
+uint8_t Uart0_Export(const void *data, uint32_t bytes, UdmaCallback done, void *arg) {
+    if (bytes == 0) return 0;
+
+    uint32_t state = Atomic_Enter();
+    if (uart0ExportState != UART0_EXPORT_IDLE) {
+        Atomic_Exit(state);
+        return 0;
+    }
+    uart0ExportNext = (const uint8_t *)data;
+    uart0ExportLeft = bytes;
+    uart0ExportDone = done;
+    uart0ExportArg = arg;
+    uart0ExportState = UART0_EXPORT_PENDING;
+    Uart0_FillFifo();                           // Starts at once if the ring is empty
+    Atomic_Exit(state);
+    return 1;
+}
+
+// Nonzero while an export is queued or running
+uint8_t Uart0_ExportBusy(void) {
+    return uart0ExportState != UART0_EXPORT_IDLE;
+}
+
+// Deliver received bytes to handler (ISR context); 0 discards them
+void Uart0_SetRxHandler(Uart0RxHandler handler) {
+    uart0RxHandler = handler;
+}
+
+// Received bytes dropped for line errors
+uint32_t Uart0_RxErrors(void) {
+    return uart0RxErrors;
+}
+
+// Characters dropped because the TX ring was full
+uint32_t Uart0_Dropped(void) {
+    return uart0TxRing.dropped;
+}
+
+// Wait until every queued character has been sent
+void Uart0_Flush(void) {
+    while (Spsc_Count(&uart0TxRing) || Uart0_ExportBusy() || (UART0_FR_R & UART_FR_BUSY)) {
+        if (Kernel_Running()) {
+            Kernel_Sleep(1);
+        }
+    }
+}
+
+// UART0 ISR: drain the RX FIFO, continue or finish an export, refill the TX FIFO
+void UART0_Handler(void) {
+    UART0_ICR_R = UART_ICR_TXIC | UART_ICR_RXIC | UART_ICR_RTIC;
+
+    while (!(UART0_FR_R & UART_FR_RXFE)) {
+        uint32_t data = UART0_DR_R;
+        if (data & (UART_DR_OE | UART_DR_BE | UART_DR_PE | UART_DR_FE)) {
+            uart0RxErrors++;
+        } else if (uart0RxHandler) {
+            uart0RxHandler((char)(data & UART_DR_DATA_M));
+        }
+    }
+
+    if (Udma_TakeDone(UDMA_CH_UART0TX)) {
+        if (uart0ExportLeft) {
+            Uart0_ExportChunk();
+        } else {
+            UART0_DMACTL_R &= ~UART_DMACTL_TXDMAE;
+            uart0ExportState = UART0_EXPORT_IDLE;
+            if (uart0ExportDone) {
+                uart0ExportDone(uart0ExportArg);
+            }
+        }
+    }
+    Uart0_FillFifo();
+}
+
+#endif // UART0_H
@@ -0,0 +1,96 @@
+#ifndef UDMA_H
+#define UDMA_H
+
+#include "tm4c123gh6pm.h"
+#include "TM4C123.h"
+#include <stdint.h>
+#include "main_api.h"
+
+// ==================== uDMA Controller ====================
+// Minimal driver for memory-to-peripheral transfers in basic mode. One
+// control table serves every channel; a transfer moves up to
+// UDMA_MAX_TRANSFER items and, when it finishes, the channel's done
+// interrupt is delivered to the peripheral's own handler, which checks it
+// with Udma_TakeDone().
+//
+// Channel assignments (UDMA_CH_* in main_api.h, shared with Nokia5110.c):
+//    9  UART0 TX
+//   11  SSI0 TX
+
+#define UDMA_MAX_TRANSFER  1024   // Items per basic-mode transfer
+
+typedef void (*UdmaCallback)(void *arg);
+
+// Control table: primary structures for channels 0-31, then the alternate
+// ones. The controller requires it to be 1024-byte aligned.
+static uint32_t udmaControlTable[256] __attribute__((aligned(1024)));
+static uint8_t udmaReady = 0;   // Set once Udma_Init has run
+
+// Function prototypes
+void Udma_Init(void);
+void Udma_ChannelInit(uint8_t channel);
+void Udma_StartToPeripheral(uint8_t channel, const void *src, volatile void *dst,
+                            uint32_t bytes, uint32_t arbSize);
+uint8_t Udma_Busy(uint8_t channel);
+uint8_t Udma_TakeDone(uint8_t channel);
+
+// Enable the controller (once). DMACFG is write-only and the module bus-faults
+// while its clock is gated, so "already running" is a flag, not a register.
+void Udma_Init(void) {
+    if (udmaReady) return;
+
+    SYSCTL_RCGCDMA_R |= 0x01;                   // Enable uDMA clock
+    while ((SYSCTL_PRDMA_R & 0x01) == 0);       // Wait for uDMA to be ready
+
+    UDMA_CFG_R = UDMA_CFG_MASTEN;               // Enable the controller
+    UDMA_CTLBASE_R = (uint32_t)udmaControlTable;
+    udmaReady = 1;
+}
+
+// Reset a channel to: primary structure, default priority, single and burst
+// requests, peripheral requests unmasked, encoding 0
+void Udma_ChannelInit(uint8_t channel) {
+    uint32_t bit = 1u << channel;
+    uint32_t shift = (channel & 7) * 4;
+    volatile uint32_t *chmap = &UDMA_CHMAP0_R + (channel >> 3);
+
+    UDMA_ENACLR_R = bit;
+    *chmap &= ~(0xFu << shift);                 // Encoding 0
+    UDMA_ALTCLR_R = bit;
+    UDMA_PRIOCLR_R = bit;
+    UDMA_USEBURSTCLR_R = bit;
+    UDMA_REQMASKCLR_R = bit;
+    UDMA_CHIS_R = bit;                          // Drop a stale done flag
+}
+
+// Start a byte transfer from RAM (incrementing) to a peripheral data
+// register (fixed). bytes must be 1..UDMA_MAX_TRANSFER.
+void Udma_StartToPeripheral(uint8_t channel, const void *src, volatile void *dst,
+                            uint32_t bytes, uint32_t arbSize) {
+    uint32_t *entry = &udmaControlTable[channel * 4];
+
+    entry[0] = (uint32_t)src + bytes - 1;       // Source end pointer
+    entry[1] = (uint32_t)dst;                   // Destination end pointer
+    entry[2] = UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 |
+               UDMA_CHCTL_SRCINC_8 | UDMA_CHCTL_SRCSIZE_8 |
+               arbSize | ((bytes - 1) << UDMA_CHCTL_XFERSIZE_S) |
+               UDMA_CHCTL_XFERMODE_BASIC;
+    UDMA_ENASET_R = 1u << channel;              // Peripheral requests drive it from here
+}
+
+// Nonzero while the channel still has items to move
+uint8_t Udma_Busy(uint8_t channel) {
+    return (UDMA_ENASET_R >> channel) & 1;
+}
+
+// Consume the channel's done flag; nonzero if it was set
+uint8_t Udma_TakeDone(uint8_t channel) {
+    uint32_t bit = 1u << channel;
+    if (UDMA_CHIS_R & bit) {
+        UDMA_CHIS_R = bit;                      // Write 1 to clear
+        return 1;
+    }
+    return 0;
+}
+
+#endif // UDMA_H
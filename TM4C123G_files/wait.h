@@ -0,0 +1,84 @@
+#ifndef WAIT_H
+#define WAIT_H
+
+#include "TM4C123.h"
+#include <stdint.h>
+#include "atomic.h"
+#include "kernel.h"
+
+// ==================== Event-Mask Waits ====================
+// ISRs raise event bits with Wait_Signal(). A task blocks in Wait_For() until
+// any bit in its mask is raised or the timeout expires, and gets back the
+// bits that ended the wait (or WAIT_TIMEOUT). Returned bits are consumed, so
+// an old event does not cut short every later wait.
+//
+// The scan, alert and averaging steps run from the event loop and must not
+// block, so they poll a bit with Wait_Pending() at each step and the owner
+// consumes it with Wait_Clear().
+//
+// Wait_Signal() posts the kernel, so it must not be called from ISRs above
+// ATOMIC_SYSCALL_PRIORITY (the echo capture signals through WTIMER0B). One
+// task at a time may block in Wait_For(): the ranging task.
+
+#define WAIT_TIMEOUT      0x00000000   // No event; the timeout expired
+#define WAIT_EVT_CANCEL   0x00000001   // Deep-sleep button: abandon current work
+#define WAIT_EVT_WAKE     0x00000002   // Comparator wake
+#define WAIT_EVT_ECHO     0x00000004   // Echo capture completed
+
+#define WAIT_FOREVER      0xFFFFFFFF   // Timeout value: no timeout
+
+static volatile uint32_t waitEvents = 0;                 // Raised, not yet consumed events
+static Semaphore waitWake = KERNEL_SEM_INIT(0, 1);       // Posted on every signal
+
+// Function prototypes
+void Wait_Signal(uint32_t bits);
+uint32_t Wait_Pending(uint32_t mask);
+void Wait_Clear(uint32_t bits);
+uint32_t Wait_For(uint32_t mask, uint32_t timeoutMs);
+
+// Raise event bits and wake the waiting task (ISR or task)
+void Wait_Signal(uint32_t bits) {
+    Atomic_Or(&waitEvents, bits);
+    Kernel_SemPost(&waitWake);
+}
+
+// Raised bits within mask, without consuming them
+uint32_t Wait_Pending(uint32_t mask) {
+    return waitEvents & mask;
+}
+
+// Consume event bits
+void Wait_Clear(uint32_t bits) {
+    Atomic_And(&waitEvents, ~bits);
+}
+
+// Consume and return the raised bits within mask
+static uint32_t Wait_Take(uint32_t mask) {
+    uint32_t old, hit;
+    do {
+        old = waitEvents;
+        hit = old & mask;
+    } while (hit && !Atomic_CompareExchange(&waitEvents, old, old & ~hit));
+    return hit;
+}
+
+// Block the calling task until an event in mask is raised or timeoutMs
+// elapses. Returns the consumed event bits, or WAIT_TIMEOUT. Task context
+// only; before Kernel_Start it only checks the bits once.
+uint32_t Wait_For(uint32_t mask, uint32_t timeoutMs) {
+    uint32_t timeout = (timeoutMs == WAIT_FOREVER) ? KERNEL_WAIT_FOREVER : KERNEL_MS_TO_TICKS(timeoutMs);
+    uint32_t deadline = Kernel_Ticks() + timeout;
+    uint32_t hit;
+
+    while (!(hit = Wait_Take(mask)) && Kernel_Running()) {
+        uint32_t left = timeout;
+        if (timeout != KERNEL_WAIT_FOREVER) {
+            left = deadline - Kernel_Ticks();
+            if ((int32_t)left <= 0) break;
+        }
+        Kernel_SemWait(&waitWake, left);   // A post for other bits just checks again
+    }
+    return hit;
+}
+
+#endif // WAIT_H
@@ -0,0 +1,219 @@
+// blog_decode.cpp
+// Host-side decoder for the binary log in TM4C123G_files/blog.h.
+//
+// Reads the BLOG format strings from the .blog_fmt section of the firmware
+// image and turns a raw UART0 capture back into text. Bytes that are not part
+// of a valid frame (ordinary prints) are copied through unchanged.
+//
+//   g++ -std=c++17 -O2 -o blog_decode blog_decode.cpp
+//   blog_decode termproject.axf [capture.bin]     (capture defaults to stdin)
+//
+// Frame: 0x1E | id u16 | argBytes u8 | timestamp us u32 | argBytes of args,
+// all little-endian, one 32-bit word per argument.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+const uint8_t kSync = 0x1E;
+const size_t kHeaderBytes = 8;   // sync, id, argBytes, timestamp
+
+struct LogSite {
+    std::string fmt;
+    size_t argCount;
+};
+
+std::vector<uint8_t> ReadAll(std::istream &in) {
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in),
+                                std::istreambuf_iterator<char>());
+}
+
+uint64_t ReadLE(const std::vector<uint8_t> &data, size_t offset, size_t bytes) {
+    if (offset + bytes > data.size()) {
+        throw std::runtime_error("truncated ELF file");
+    }
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; i++) {
+        value |= uint64_t(data[offset + i]) << (8 * i);
+    }
+    return value;
+}
+
+// Number of arguments a printf format consumes ("%%" takes none)
+size_t CountArgs(const std::string &fmt) {
+    size_t count = 0;
+    for (size_t i = 0; i < fmt.size(); i++) {
+        if (fmt[i] != '%') continue;
+        if (i + 1 < fmt.size() && fmt[i + 1] == '%') {
+            i++;
+            continue;
+        }
+        count++;
+    }
+    return count;
+}
+
+// Locate .blog_fmt in a little-endian ELF32/ELF64 image and read its sites
+std::map<uint32_t, LogSite> LoadSites(const std::vector<uint8_t> &elf) {
+    if (elf.size() < 0x40 || std::memcmp(elf.data(), "\x7F" "ELF", 4) != 0) {
+        throw std::runtime_error("not an ELF file");
+    }
+    if (elf[5] != 1) {
+        throw std::runtime_error("big-endian ELF not supported");
+    }
+    const bool is64 = elf[4] == 2;
+    const size_t word = is64 ? 8 : 4;
+
+    const uint64_t shoff = ReadLE(elf, is64 ? 0x28 : 0x20, word);
+    const size_t shentsize = ReadLE(elf, is64 ? 0x3A : 0x2E, 2);
+    const size_t shnum = ReadLE(elf, is64 ? 0x3C : 0x30, 2);
+    const size_t shstrndx = ReadLE(elf, is64 ? 0x3E : 0x32, 2);
+
+    auto sectionOffset = [&](size_t index) {
+        return ReadLE(elf, shoff + index * shentsize + (is64 ? 0x18 : 0x10), word);
+    };
+    auto sectionSize = [&](size_t index) {
+        return ReadLE(elf, shoff + index * shentsize + (is64 ? 0x20 : 0x14), word);
+    };
+    const uint64_t names = sectionOffset(shstrndx);
+
+    for (size_t s = 0; s < shnum; s++) {
+        const uint64_t nameOffset = names + ReadLE(elf, shoff + s * shentsize, 4);
+        if (nameOffset >= elf.size() ||
+            std::strcmp(reinterpret_cast<const char *>(&elf[nameOffset]), ".blog_fmt") != 0) {
+            continue;
+        }
+
+        std::map<uint32_t, LogSite> sites;
+        size_t pos = sectionOffset(s);
+        const size_t end = pos + sectionSize(s);
+        if (end > elf.size()) {
+            throw std::runtime_error("truncated .blog_fmt section");
+        }
+        while (pos + 4 < end) {
+            const uint32_t id = ReadLE(elf, pos, 4);
+            pos += 4;
+            const size_t len = strnlen(reinterpret_cast<const char *>(&elf[pos]), end - pos);
+            std::string fmt(reinterpret_cast<const char *>(&elf[pos]), len);
+            pos += len + 1;
+            sites[id] = LogSite{fmt, CountArgs(fmt)};   // Inlined copies repeat an id
+        }
+        return sites;
+    }
+    throw std::runtime_error("no .blog_fmt section (built with BLOG_ENABLED 0?)");
+}
+
+// Expand fmt with one 32-bit word per conversion
+std::string Render(const std::string &fmt, const uint8_t *args) {
+    std::string out;
+    size_t arg = 0;
+
+    for (size_t i = 0; i < fmt.size(); i++) {
+        if (fmt[i] != '%') {
+            out += fmt[i];
+            continue;
+        }
+        if (i + 1 < fmt.size() && fmt[i + 1] == '%') {
+            out += '%';
+            i++;
+            continue;
+        }
+
+        // Copy the spec without length modifiers: every argument is 32 bits
+        std::string spec = "%";
+        size_t j = i + 1;
+        while (j < fmt.size() && std::strchr("-+ #0123456789.hlzjtL", fmt[j])) {
+            if (!std::strchr("hlzjtL", fmt[j])) spec += fmt[j];
+            j++;
+        }
+        if (j == fmt.size()) {
+            out += fmt.substr(i);
+            break;
+        }
+        const char conv = fmt[j];
+        spec += conv;
+        i = j;
+
+        uint32_t bits;
+        std::memcpy(&bits, args + 4 * arg++, 4);   // Host assumed little-endian
+
+        char text[64];
+        if (std::strchr("fFeEgGaA", conv)) {
+            float value;
+            std::memcpy(&value, &bits, 4);
+            std::snprintf(text, sizeof(text), spec.c_str(), double(value));
+        } else if (conv == 'd' || conv == 'i') {
+            std::snprintf(text, sizeof(text), spec.c_str(), int32_t(bits));
+        } else if (std::strchr("uxXoc", conv)) {
+            std::snprintf(text, sizeof(text), spec.c_str(), bits);
+        } else {
+            std::snprintf(text, sizeof(text), "<%%%c?>", conv);
+        }
+        out += text;
+    }
+    return out;
+}
+
+// Decode a capture, passing non-frame bytes through
+void Decode(const std::vector<uint8_t> &in, const std::map<uint32_t, LogSite> &sites,
+            std::ostream &out) {
+    size_t pos = 0;
+    while (pos < in.size()) {
+        if (in[pos] == kSync && pos + kHeaderBytes <= in.size()) {
+            const uint32_t id = in[pos + 1] | (in[pos + 2] << 8);
+            const size_t argBytes = in[pos + 3];
+            auto site = sites.find(id);
+            if (site != sites.end() && argBytes == 4 * site->second.argCount &&
+                pos + kHeaderBytes + argBytes <= in.size()) {
+                uint32_t us = 0;
+                for (size_t i = 0; i < 4; i++) {
+                    us |= uint32_t(in[pos + 4 + i]) << (8 * i);
+                }
+                char stamp[32];
+                std::snprintf(stamp, sizeof(stamp), "[%6u.%06u] ", us / 1000000, us % 1000000);
+                out << stamp << Render(site->second.fmt, &in[pos + kHeaderBytes]) << '\n';
+                pos += kHeaderBytes + argBytes;
+                continue;
+            }
+        }
+        out << char(in[pos++]);   // Not a frame we know
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "usage: " << argv[0] << " firmware.axf [capture.bin]\n";
+        return 2;
+    }
+
+    try {
+        std::ifstream elfFile(argv[1], std::ios::binary);
+        if (!elfFile) throw std::runtime_error(std::string("cannot open ") + argv[1]);
+        const std::map<uint32_t, LogSite> sites = LoadSites(ReadAll(elfFile));
+
+        std::vector<uint8_t> capture;
+        if (argc == 3) {
+            std::ifstream captureFile(argv[2], std::ios::binary);
+            if (!captureFile) throw std::runtime_error(std::string("cannot open ") + argv[2]);
+            capture = ReadAll(captureFile);
+        } else {
+            capture = ReadAll(std::cin);
+        }
+        Decode(capture, sites, std::cout);
+    } catch (const std::exception &e) {
+        std::cerr << argv[0] << ": " << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,298 @@
+// fontgen.cpp
+// Host-side generator for the framebuffer fonts in TM4C123G_files/font.h.
+//
+// Turns a text font source (host/fonts/*.fnt) into a C header holding the
+// glyphs pre-shifted for the Nokia5110 bank layout, so Font_DrawChar can
+// blit a glyph at any pixel row with whole-byte operations. The generated
+// headers are committed, so the Keil build does not need it; after editing a
+// font, regenerate them from the host build:
+//
+//   cmake -S host -B build && cmake --build build --target fonts
+//
+// or by hand: fontgen fonts/digits16.fnt ../TM4C123G_files/font_digits16.h
+//
+// The header is only rewritten when its contents change, so an unchanged
+// font does not force a rebuild.
+//
+// Source format ('#' starts a comment line):
+//
+//   font <C identifier>     name of the Font object and the table prefix
+//   height <rows>           pixel rows per glyph, 1-32
+//   spacing <columns>       blank columns after each glyph
+//   glyph <code> [comment]  code 0x20-0xFF, then 'height' rows of '#'/'.',
+//                           every row as wide as the glyph (1-32 columns)
+//
+// Output, per glyph: for each shift 0-7, (height + 14) / 8 bank rows of one
+// byte per column; bit n of a byte is pixel row 8 * bankRow + n of the glyph
+// moved down by shift pixels.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int kShifts = 8;
+const int kMaxRows = 32;
+const int kMaxWidth = 32;
+const uint8_t kNoGlyph = 0xFF;   // FONT_NO_GLYPH in font.h
+
+struct Glyph {
+    int code;
+    std::string comment;
+    std::vector<std::string> rows;
+};
+
+struct FontSource {
+    std::string name;
+    int height = 0;
+    int spacing = 0;
+    std::vector<Glyph> glyphs;
+};
+
+std::runtime_error ParseError(const std::string &path, int line, const std::string &what) {
+    return std::runtime_error(path + ":" + std::to_string(line) + ": " + what);
+}
+
+int ParseNumber(const std::string &text, const std::string &path, int line) {
+    char *end = nullptr;
+    const long value = std::strtol(text.c_str(), &end, 0);
+    if (text.empty() || *end != '\0') {
+        throw ParseError(path, line, "bad number '" + text + "'");
+    }
+    return int(value);
+}
+
+bool IsIdentifier(const std::string &name) {
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) return false;
+    for (char c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') return false;
+    }
+    return true;
+}
+
+FontSource Parse(const std::string &path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("cannot open " + path);
+    }
+
+    FontSource font;
+    std::string text;
+    int line = 0;
+    while (std::getline(in, text)) {
+        line++;
+        if (!text.empty() && text.back() == '\r') text.pop_back();
+
+        // Inside a glyph every line is a bitmap row
+        if (!font.glyphs.empty() && font.glyphs.back().rows.size() < size_t(font.height)) {
+            Glyph &glyph = font.glyphs.back();
+            if (text.empty() || text.find_first_not_of(".#") != std::string::npos) {
+                throw ParseError(path, line, "glyph row may only contain '#' and '.'");
+            }
+            if (!glyph.rows.empty() && text.size() != glyph.rows[0].size()) {
+                throw ParseError(path, line, "glyph rows differ in width");
+            }
+            if (text.size() > size_t(kMaxWidth)) {
+                throw ParseError(path, line, "glyph wider than 32 columns");
+            }
+            glyph.rows.push_back(text);
+            continue;
+        }
+        if (text.empty() || text[0] == '#') {
+            continue;
+        }
+
+        std::istringstream words(text);
+        std::string key, value;
+        words >> key >> value;
+        if (key == "font") {
+            if (!IsIdentifier(value)) throw ParseError(path, line, "font needs a C identifier");
+            font.name = value;
+        } else if (key == "height") {
+            font.height = ParseNumber(value, path, line);
+            if (font.height < 1 || font.height > kMaxRows) {
+                throw ParseError(path, line, "height must be 1-32");
+            }
+        } else if (key == "spacing") {
+            font.spacing = ParseNumber(value, path, line);
+            if (font.spacing < 0 || font.spacing > 255) {
+                throw ParseError(path, line, "spacing must be 0-255");
+            }
+        } else if (key == "glyph") {
+            if (font.height == 0) throw ParseError(path, line, "height must come before glyphs");
+            Glyph glyph;
+            glyph.code = ParseNumber(value, path, line);
+            if (glyph.code < 0x20 || glyph.code > 0xFF) {
+                throw ParseError(path, line, "glyph code must be 0x20-0xFF");
+            }
+            for (const Glyph &other : font.glyphs) {
+                if (other.code == glyph.code) throw ParseError(path, line, "duplicate glyph");
+            }
+            std::getline(words >> std::ws, glyph.comment);
+            font.glyphs.push_back(glyph);
+        } else {
+            throw ParseError(path, line, "unknown keyword '" + key + "'");
+        }
+    }
+
+    if (font.name.empty()) throw std::runtime_error(path + ": missing 'font' line");
+    if (font.glyphs.empty()) throw std::runtime_error(path + ": no glyphs");
+    if (font.glyphs.size() >= kNoGlyph) throw std::runtime_error(path + ": too many glyphs");
+    if (font.glyphs.back().rows.size() != size_t(font.height)) {
+        throw std::runtime_error(path + ": last glyph is missing rows");
+    }
+    return font;
+}
+
+// Column bytes of one glyph moved down by shift pixels
+std::vector<uint8_t> Shifted(const Glyph &glyph, int shift, int bankRows, int stride) {
+    std::vector<uint8_t> bytes(size_t(bankRows) * stride, 0);
+    for (size_t y = 0; y < glyph.rows.size(); y++) {
+        const int row = int(y) + shift;
+        for (size_t x = 0; x < glyph.rows[y].size(); x++) {
+            if (glyph.rows[y][x] == '#') {
+                bytes[size_t(row / 8) * stride + x] |= uint8_t(1u << (row % 8));
+            }
+        }
+    }
+    return bytes;
+}
+
+std::string Hex(unsigned value) {
+    char text[8];
+    std::snprintf(text, sizeof(text), "0x%02X", value);
+    return text;
+}
+
+// Comments are copied into C; keep them printable ASCII
+std::string Printable(const std::string &text) {
+    std::string out;
+    for (char c : text) {
+        const unsigned char u = static_cast<unsigned char>(c);
+        out += (u >= 0x20 && u < 0x7F && c != '\\') ? c : '?';
+    }
+    return out;
+}
+
+std::string Generate(const FontSource &font, const std::string &sourceName,
+                     const std::string &headerName) {
+    const char *nl = "\r\n";   // The firmware tree uses CRLF
+    int first = 0xFF, last = 0, stride = 0;
+    for (const Glyph &glyph : font.glyphs) {
+        first = std::min(first, glyph.code);
+        last = std::max(last, glyph.code);
+        stride = std::max(stride, int(glyph.rows[0].size()));
+    }
+    const int count = last - first + 1;
+    const int bankRows = (font.height + 14) / 8;   // Rows touched at the worst shift
+
+    std::string guard;
+    for (char c : headerName) {
+        guard += std::isalnum(static_cast<unsigned char>(c))
+                     ? char(std::toupper(static_cast<unsigned char>(c))) : '_';
+    }
+
+    std::ostringstream out;
+    out << "// " << headerName << nl
+        << "// Generated by host/fontgen.cpp from " << sourceName << "; do not edit." << nl
+        << "// " << font.glyphs.size() << " glyphs, " << font.height << " rows, "
+        << bankRows << " bank rows per shift." << nl << nl
+        << "#ifndef " << guard << nl << "#define " << guard << nl << nl
+        << "#include \"font.h\"" << nl << nl;
+
+    // Character code -> glyph number
+    std::vector<uint8_t> index(count, kNoGlyph);
+    for (size_t g = 0; g < font.glyphs.size(); g++) {
+        index[font.glyphs[g].code - first] = uint8_t(g);
+    }
+    out << "// Glyph number per character code from " << Hex(first) << " (FONT_NO_GLYPH: none)" << nl
+        << "static const uint8_t " << font.name << "Index[" << count << "] = {" << nl;
+    for (int i = 0; i < count; i += 16) {
+        out << "   ";
+        for (int j = i; j < std::min(count, i + 16); j++) out << " " << Hex(index[j]) << ",";
+        out << "   // " << Hex(first + i) << nl;
+    }
+    out << "};" << nl << nl;
+
+    out << "// Columns per glyph" << nl
+        << "static const uint8_t " << font.name << "Width[" << font.glyphs.size() << "] = {" << nl;
+    for (size_t i = 0; i < font.glyphs.size(); i += 16) {
+        out << "   ";
+        for (size_t j = i; j < std::min(font.glyphs.size(), i + 16); j++) {
+            out << " " << font.glyphs[j].rows[0].size() << ",";
+        }
+        out << nl;
+    }
+    out << "};" << nl << nl;
+
+    out << "// [glyph][shift 0-7][bank row 0-" << bankRows - 1 << "][column 0-" << stride - 1
+        << "]" << nl
+        << "static const uint8_t " << font.name << "Glyphs[" << font.glyphs.size() << " * "
+        << kShifts << " * " << bankRows << " * " << stride << "] = {" << nl;
+    for (const Glyph &glyph : font.glyphs) {
+        out << "    // " << Hex(glyph.code) << " " << Printable(glyph.comment) << nl;
+        for (int shift = 0; shift < kShifts; shift++) {
+            const std::vector<uint8_t> bytes = Shifted(glyph, shift, bankRows, stride);
+            for (int row = 0; row < bankRows; row++) {
+                out << "   ";
+                for (int x = 0; x < stride; x++) out << " " << Hex(bytes[size_t(row) * stride + x]) << ",";
+                out << nl;
+            }
+        }
+    }
+    out << "};" << nl << nl;
+
+    out << "static const Font " << font.name << " = {" << nl
+        << "    " << font.height << ", " << stride << ", " << bankRows << ", " << font.spacing
+        << ", " << Hex(first) << ", " << count << "," << nl
+        << "    " << font.name << "Index, " << font.name << "Width, " << font.name << "Glyphs" << nl
+        << "};" << nl << nl
+        << "#endif // " << guard << nl;
+    return out.str();
+}
+
+std::string BaseName(const std::string &path) {
+    const size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " font.fnt font.h\n";
+        return 2;
+    }
+
+    try {
+        const std::string header =
+            Generate(Parse(argv[1]), "fonts/" + BaseName(argv[1]), BaseName(argv[2]));
+
+        std::ifstream old(argv[2], std::ios::binary);
+        if (old && std::string(std::istreambuf_iterator<char>(old),
+                               std::istreambuf_iterator<char>()) == header) {
+            return 0;   // Up to date: leave the timestamp alone
+        }
+        old.close();
+
+        std::ofstream out(argv[2], std::ios::binary);
+        out << header;
+        if (!out) {
+            throw std::runtime_error(std::string("cannot write ") + argv[2]);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "fontgen: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,370 @@
+// scan_archive.cpp
+// Capture daemon for soak tests: appends every complete scan from the scan
+// stream (TM4C123G_files/scan_stream.h) to a memory-mapped, column-oriented
+// archive, and answers time-range queries from its block index.
+//
+//   g++ -std=c++17 -O2 -o scan_archive scan_archive.cpp
+//   scan_archive ingest [-b baud] <archive_dir> <device|file|->
+//   scan_archive query <archive_dir> [from_ns [to_ns]]
+//
+// Archive layout (all little-endian, host byte order):
+//   scans.col  page 0: ArchiveHeader, then blocks of kScansPerBlock rows.
+//              Inside a block every field is its own column, and each
+//              distance bin is a fixed-width u16 column, so reading one bin
+//              over time touches one contiguous array per block.
+//   scans.idx  one BlockIndex per block: host time range, first scan id and
+//              row count, for finding the blocks of a time range without
+//              touching their data.
+//
+// Both files are mapped at their current size and grown with ftruncate;
+// a file that outgrows its mapping is remapped with twice the room, so
+// remaps are rare. Packets are decoded straight into their columns. A row is only counted once its END
+// packet arrives; a scan cut off by a reset is overwritten by the next one.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "scan_protocol.h"
+#include "serial_input.h"
+
+namespace {
+
+const char kMagic[8] = {'S', 'C', 'N', 'A', 'R', 'C', 'H', '1'};
+const uint32_t kVersion = 1;
+const uint32_t kMaxBins = 180;          // MAX_STEPS on the target
+const uint32_t kScansPerBlock = 256;
+const size_t kPage = 4096;
+
+struct ArchiveHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t maxBins;
+    uint32_t scansPerBlock;
+    uint32_t blockBytes;
+    uint64_t blockCount;                // Including the block being filled
+    uint64_t scanCount;                 // Complete rows over all blocks
+};
+
+struct BlockIndex {
+    int64_t firstNs;                    // Host receive time of the first row
+    int64_t lastNs;                     // ... and of the last row
+    uint32_t firstScanId;
+    uint32_t count;                     // Complete rows in the block
+};
+
+// Byte offsets of the columns inside a block
+struct BlockLayout {
+    size_t hostNs, scanId, startUs, tempCentiC, fromDeg, toDeg, bins;
+    size_t objAngle, objDistance, detected, distance;
+    size_t bytes;
+
+    BlockLayout() {
+        const size_t s = kScansPerBlock;
+        size_t off = 0;
+        hostNs = off;      off += 8 * s;
+        scanId = off;      off += 4 * s;
+        startUs = off;     off += 4 * s;
+        tempCentiC = off;  off += 2 * s;
+        fromDeg = off;     off += 2 * s;
+        toDeg = off;       off += 2 * s;
+        bins = off;        off += 2 * s;
+        objAngle = off;    off += 2 * s;
+        objDistance = off; off += 2 * s;
+        detected = off;    off += 1 * s;
+        off = (off + 7) & ~size_t(7);
+        distance = off;    off += 2 * s * kMaxBins;   // Column b at distance + 2*s*b
+        bytes = (off + kPage - 1) & ~(kPage - 1);
+    }
+};
+
+int64_t NowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return int64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+// A memory-mapped file. Grow() extends the file and, once it no longer fits
+// the mapping, remaps it with twice the room: pointers into Data() are only
+// valid until the next Grow().
+class MappedFile {
+public:
+    MappedFile(const std::string &path, bool create) : path_(path), writable_(create) {
+        fd_ = open(path.c_str(), create ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+        if (fd_ < 0) throw std::runtime_error("cannot open " + path + ": " + std::strerror(errno));
+        struct stat st;
+        if (fstat(fd_, &st) != 0) {
+            const int err = errno;
+            close(fd_);
+            throw std::runtime_error("cannot stat " + path + ": " + std::strerror(err));
+        }
+        size_ = size_t(st.st_size);
+        try {
+            Map(size_);
+        } catch (...) {
+            close(fd_);
+            throw;
+        }
+    }
+
+    ~MappedFile() {
+        if (mapped_) munmap(base_, mapped_);
+        close(fd_);
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    void Grow(size_t bytes) {
+        if (bytes <= size_) return;
+        if (ftruncate(fd_, off_t(bytes)) != 0) {
+            throw std::runtime_error("cannot grow " + path_ + ": " + std::strerror(errno));
+        }
+        size_ = bytes;
+        if (bytes > mapped_) Map(std::max(bytes, 2 * mapped_));
+    }
+
+    uint8_t *Data() const { return base_; }
+    size_t Size() const { return size_; }
+
+private:
+    // (Re)map the first bytes of the file, rounded up to whole pages
+    void Map(size_t bytes) {
+        bytes = (bytes + kPage - 1) / kPage * kPage;
+        if (mapped_) munmap(base_, mapped_);
+        base_ = nullptr;
+        mapped_ = 0;
+        if (bytes == 0) return;                 // Empty file: nothing to map yet
+        void *p = mmap(nullptr, bytes, writable_ ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd_, 0);
+        if (p == MAP_FAILED) throw std::runtime_error("cannot map " + path_ + ": " + std::strerror(errno));
+        base_ = static_cast<uint8_t *>(p);
+        mapped_ = bytes;
+    }
+
+    std::string path_;
+    bool writable_;
+    int fd_ = -1;
+    uint8_t *base_ = nullptr;
+    size_t size_ = 0;
+    size_t mapped_ = 0;
+};
+
+class Archive {
+public:
+    Archive(const std::string &dir, bool writable)
+        : col_(dir + "/scans.col", writable), idx_(dir + "/scans.idx", writable) {
+        if (col_.Size() == 0) {
+            if (!writable) throw std::runtime_error("empty archive");
+            col_.Grow(kPage);
+            ArchiveHeader *h = Header();
+            std::memcpy(h->magic, kMagic, sizeof(kMagic));
+            h->version = kVersion;
+            h->maxBins = kMaxBins;
+            h->scansPerBlock = kScansPerBlock;
+            h->blockBytes = uint32_t(layout_.bytes);
+            h->blockCount = 0;
+            h->scanCount = 0;
+        }
+        const ArchiveHeader *h = Header();
+        if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0 || h->version != kVersion ||
+            h->maxBins != kMaxBins || h->scansPerBlock != kScansPerBlock || h->blockBytes != layout_.bytes) {
+            throw std::runtime_error("not a compatible scan archive");
+        }
+        if (col_.Size() < kPage + h->blockCount * layout_.bytes ||
+            idx_.Size() < h->blockCount * sizeof(BlockIndex)) {
+            throw std::runtime_error("truncated scan archive");
+        }
+    }
+
+    ArchiveHeader *Header() { return reinterpret_cast<ArchiveHeader *>(col_.Data()); }
+    BlockIndex *Index() { return reinterpret_cast<BlockIndex *>(idx_.Data()); }
+
+    template <typename T>
+    T *Column(uint64_t block, size_t offset) {
+        return reinterpret_cast<T *>(col_.Data() + kPage + block * layout_.bytes + offset);
+    }
+
+    uint16_t *DistanceColumn(uint64_t block, uint32_t bin) {
+        return Column<uint16_t>(block, layout_.distance + size_t(2) * kScansPerBlock * bin);
+    }
+
+    // Row for the next scan: the first free row of the last block, or a new block
+    void NextRow(uint64_t &block, uint32_t &row) {
+        uint64_t blocks = Header()->blockCount;
+        if (blocks == 0 || Index()[blocks - 1].count == kScansPerBlock) {
+            col_.Grow(kPage + (blocks + 1) * layout_.bytes);      // May remap: no pointers held
+            idx_.Grow((blocks + 1) * sizeof(BlockIndex));
+            Index()[blocks] = BlockIndex();
+            Header()->blockCount = ++blocks;
+        }
+        block = blocks - 1;
+        row = Index()[block].count;
+    }
+
+    // The row filled since NextRow() is complete
+    void Commit(uint64_t block, uint32_t row, int64_t hostNs, uint32_t scanId) {
+        BlockIndex &ix = Index()[block];
+        if (row == 0) {
+            ix.firstNs = hostNs;
+            ix.firstScanId = scanId;
+        }
+        ix.lastNs = hostNs;
+        ix.count = row + 1;
+        Header()->scanCount++;
+    }
+
+    const BlockLayout &Layout() const { return layout_; }
+
+private:
+    BlockLayout layout_;
+    MappedFile col_;
+    MappedFile idx_;
+};
+
+// Write packets straight into the current row's columns
+class Ingest {
+public:
+    explicit Ingest(Archive &archive) : ar_(archive) {}
+
+    void operator()(const scan::Packet &pkt) {
+        const BlockLayout &L = ar_.Layout();
+        switch (pkt.type) {
+        case scan::kPacketBegin:
+            ar_.NextRow(block_, row_);
+            open_ = true;
+            scanId_ = pkt.scanId;
+            hostNs_ = NowNs();
+            ar_.Column<int64_t>(block_, L.hostNs)[row_] = hostNs_;
+            ar_.Column<uint32_t>(block_, L.scanId)[row_] = pkt.scanId;
+            ar_.Column<uint32_t>(block_, L.startUs)[row_] = pkt.startUs;
+            ar_.Column<int16_t>(block_, L.tempCentiC)[row_] = pkt.tempCentiC;
+            ar_.Column<int16_t>(block_, L.fromDeg)[row_] = pkt.fromDeg;
+            ar_.Column<int16_t>(block_, L.toDeg)[row_] = pkt.toDeg;
+            ar_.Column<uint16_t>(block_, L.bins)[row_] = pkt.bins;
+            for (uint32_t b = 0; b < kMaxBins; b++) {
+                ar_.DistanceColumn(block_, b)[row_] = scan::kNoEcho;
+            }
+            break;
+
+        case scan::kPacketBin:
+            if (!open_ || pkt.scanId != scanId_ || pkt.bin >= kMaxBins) return;
+            ar_.DistanceColumn(block_, pkt.bin)[row_] = pkt.distanceCm;
+            break;
+
+        case scan::kPacketEnd:
+            if (!open_ || pkt.scanId != scanId_) return;
+            ar_.Column<int16_t>(block_, L.objAngle)[row_] = pkt.detected ? pkt.angleDeg : int16_t(-1);
+            ar_.Column<uint16_t>(block_, L.objDistance)[row_] = pkt.detected ? pkt.distanceCm : scan::kNoEcho;
+            ar_.Column<uint8_t>(block_, L.detected)[row_] = pkt.detected;
+            ar_.Commit(block_, row_, hostNs_, scanId_);
+            open_ = false;
+            committed++;
+            break;
+        }
+    }
+
+    uint64_t committed = 0;
+
+private:
+    Archive &ar_;
+    uint64_t block_ = 0;
+    uint32_t row_ = 0;
+    uint32_t scanId_ = 0;
+    int64_t hostNs_ = 0;
+    bool open_ = false;
+};
+
+int RunIngest(const std::string &dir, const std::string &input, uint32_t baud) {
+    mkdir(dir.c_str(), 0755);
+    Archive archive(dir, true);
+    Ingest ingest(archive);
+    scan::FrameReader reader;
+    const int fd = scan::OpenScanInput(input, baud);
+
+    uint8_t buf[16384];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+        reader.Feed(buf, size_t(n), ingest);
+    }
+    std::cerr << "archived " << ingest.committed << " scans (" << archive.Header()->scanCount
+              << " total), " << reader.badFrames << " bad frames\n";
+    return 0;
+}
+
+// One line per scan whose host time is in [fromNs, toNs]
+int RunQuery(const std::string &dir, int64_t fromNs, int64_t toNs) {
+    Archive archive(dir, false);
+    const BlockLayout &L = archive.Layout();
+    const uint64_t blocks = archive.Header()->blockCount;
+
+    std::printf("# host_ns scan_id temp_c bins detected angle_deg distance_cm nearest_cm\n");
+    for (uint64_t blk = 0; blk < blocks; blk++) {
+        const BlockIndex &ix = archive.Index()[blk];
+        if (ix.count == 0 || ix.lastNs < fromNs || ix.firstNs > toNs) continue;   // Index only
+
+        const int64_t *hostNs = archive.Column<int64_t>(blk, L.hostNs);
+        for (uint32_t r = 0; r < ix.count; r++) {
+            if (hostNs[r] < fromNs || hostNs[r] > toNs) continue;
+            const uint16_t bins = std::min<uint32_t>(archive.Column<uint16_t>(blk, L.bins)[r], kMaxBins);
+            uint16_t nearest = scan::kNoEcho;
+            for (uint32_t b = 0; b < bins; b++) {
+                nearest = std::min(nearest, archive.DistanceColumn(blk, b)[r]);
+            }
+            std::printf("%" PRId64 " %u %.2f %u %u %d %u %u\n", hostNs[r],
+                        archive.Column<uint32_t>(blk, L.scanId)[r],
+                        archive.Column<int16_t>(blk, L.tempCentiC)[r] / 100.0, bins,
+                        archive.Column<uint8_t>(blk, L.detected)[r],
+                        archive.Column<int16_t>(blk, L.objAngle)[r],
+                        archive.Column<uint16_t>(blk, L.objDistance)[r], nearest);
+        }
+    }
+    return 0;
+}
+
+void Usage(const char *argv0) {
+    std::cerr << "usage: " << argv0 << " ingest [-b baud] <archive_dir> <device|file|->\n"
+              << "       " << argv0 << " query <archive_dir> [from_ns [to_ns]]\n";
+    std::exit(2);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 3) Usage(argv[0]);
+    const std::string mode = argv[1];
+
+    try {
+        if (mode == "ingest") {
+            uint32_t baud = 115200;
+            int arg = 2;
+            if (std::strcmp(argv[arg], "-b") == 0 && argc > arg + 1) {
+                baud = std::strtoul(argv[arg + 1], nullptr, 10);
+                arg += 2;
+            }
+            if (argc != arg + 2) Usage(argv[0]);
+            return RunIngest(argv[arg], argv[arg + 1], baud);
+        }
+        if (mode == "query" && argc <= 5) {
+            const int64_t from = argc > 3 ? std::strtoll(argv[3], nullptr, 10) : INT64_MIN;
+            const int64_t to = argc > 4 ? std::strtoll(argv[4], nullptr, 10) : INT64_MAX;
+            return RunQuery(argv[2], from, to);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << argv[0] << ": " << e.what() << '\n';
+        return 1;
+    }
+    Usage(argv[0]);
+    return 2;
+}
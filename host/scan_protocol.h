@@ -0,0 +1,157 @@
+// scan_protocol.h
+// Host side of the scan streaming protocol in TM4C123G_files/scan_stream.h:
+// CRC-16/CCITT-FALSE, COBS decoding, packet parsing and a frame splitter
+// that finds packets in a UART0 byte stream shared with text and logs.
+
+#ifndef SCAN_PROTOCOL_H
+#define SCAN_PROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace scan {
+
+enum PacketType : uint8_t {
+    kPacketBegin = 1,
+    kPacketBin = 2,
+    kPacketEnd = 3,
+};
+
+const uint16_t kNoEcho = 0xFFFF;      // distanceCm of a bin without an echo
+const size_t kMaxFrame = 64;          // Longer runs between delimiters are not ours
+
+struct Packet {
+    uint8_t type;
+    uint32_t scanId;
+    // BEGIN
+    uint32_t startUs;
+    int16_t tempCentiC;
+    int16_t fromDeg;
+    int16_t toDeg;
+    // BEGIN and END
+    uint16_t bins;
+    // BIN
+    uint16_t bin;
+    uint32_t timeUs;
+    // BIN and END (END: the detected object)
+    int16_t angleDeg;
+    uint16_t distanceCm;
+    // END
+    uint8_t detected;
+};
+
+inline uint16_t Crc16Ccitt(const uint8_t *data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    while (len--) {
+        crc ^= uint16_t(*data++) << 8;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? uint16_t((crc << 1) ^ 0x1021) : uint16_t(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// Decode one COBS frame (without its delimiter). Returns false if malformed.
+inline bool CobsDecode(const uint8_t *src, size_t len, std::vector<uint8_t> &out) {
+    out.clear();
+    size_t i = 0;
+    while (i < len) {
+        const uint8_t code = src[i++];
+        if (code == 0 || i + code - 1 > len) return false;
+        out.insert(out.end(), src + i, src + i + code - 1);
+        i += code - 1;
+        if (code != 0xFF && i < len) out.push_back(0);
+    }
+    return true;
+}
+
+inline uint16_t Get16(const uint8_t *p) {
+    return uint16_t(p[0] | (p[1] << 8));
+}
+
+inline uint32_t Get32(const uint8_t *p) {
+    return uint32_t(Get16(p)) | (uint32_t(Get16(p + 2)) << 16);
+}
+
+// Check the CRC of a decoded payload and parse it
+inline bool ParsePacket(const std::vector<uint8_t> &data, Packet &pkt) {
+    if (data.size() < 7) return false;
+    const size_t len = data.size() - 2;
+    if (Crc16Ccitt(data.data(), len) != Get16(&data[len])) return false;
+
+    const uint8_t *p = data.data();
+    pkt = Packet();
+    pkt.type = p[0];
+    pkt.scanId = Get32(p + 1);
+    p += 5;
+
+    switch (pkt.type) {
+    case kPacketBegin:
+        if (len != 17) return false;
+        pkt.startUs = Get32(p);
+        pkt.tempCentiC = int16_t(Get16(p + 4));
+        pkt.fromDeg = int16_t(Get16(p + 6));
+        pkt.toDeg = int16_t(Get16(p + 8));
+        pkt.bins = Get16(p + 10);
+        return true;
+    case kPacketBin:
+        if (len != 15) return false;
+        pkt.bin = Get16(p);
+        pkt.angleDeg = int16_t(Get16(p + 2));
+        pkt.distanceCm = Get16(p + 4);
+        pkt.timeUs = Get32(p + 6);
+        return true;
+    case kPacketEnd:
+        if (len != 12) return false;
+        pkt.bins = Get16(p);
+        pkt.detected = p[2];
+        pkt.angleDeg = int16_t(Get16(p + 3));
+        pkt.distanceCm = Get16(p + 5);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Splits a byte stream at 0x00 delimiters and hands valid packets to a
+// callback. Everything else (text, logs, broken frames) is counted and dropped.
+class FrameReader {
+public:
+    uint64_t packets = 0;
+    uint64_t badFrames = 0;     // Right size for a packet but failed COBS/CRC/layout
+
+    template <typename Handler>
+    void Feed(const uint8_t *data, size_t len, Handler &&handler) {
+        for (size_t i = 0; i < len; i++) {
+            if (data[i] != 0) {
+                if (frame_.size() < kMaxFrame) {
+                    frame_.push_back(data[i]);
+                } else {
+                    overflow_ = true;
+                }
+                continue;
+            }
+            if (!overflow_ && !frame_.empty()) {
+                Packet pkt;
+                if (CobsDecode(frame_.data(), frame_.size(), decoded_) && ParsePacket(decoded_, pkt)) {
+                    packets++;
+                    handler(pkt);
+                } else {
+                    badFrames++;
+                }
+            }
+            frame_.clear();
+            overflow_ = false;
+        }
+    }
+
+private:
+    std::vector<uint8_t> frame_;
+    std::vector<uint8_t> decoded_;
+    bool overflow_ = false;
+};
+
+}  // namespace scan
+
+#endif  // SCAN_PROTOCOL_H
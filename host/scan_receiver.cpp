@@ -0,0 +1,229 @@
+// scan_receiver.cpp
+// Live viewer for the scan stream (TM4C123G_files/scan_stream.h).
+//
+// Reads a serial port, pty, capture file or stdin, validates the COBS/CRC
+// frames and redraws a polar plot of the scan in progress on the terminal.
+// With -o it also writes one PPM image per completed scan.
+//
+//   g++ -std=c++17 -O2 -o scan_receiver scan_receiver.cpp
+//   scan_receiver [-b baud] [-r max_cm] [-o image_dir] [-q] [-l label] /dev/ttyACM0
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "scan_protocol.h"
+#include "serial_input.h"
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+const int kPlotRadius = 30;             // Terminal columns from centre to edge
+const int kImageRadius = 200;           // Pixels
+
+struct Options {
+    std::string input;
+    std::string imageDir;
+    std::string label;
+    uint32_t baud = 115200;
+    int maxCm = 100;                    // Plot edge, matches the LCD's MAX_DISTANCE
+    bool quiet = false;
+};
+
+struct Bin {
+    int16_t angleDeg;
+    uint16_t distanceCm;
+};
+
+struct ScanView {
+    bool active = false;
+    scan::Packet begin;
+    std::vector<Bin> bins;              // In arrival order
+    bool ended = false;
+    scan::Packet end;
+};
+
+// Polar position of a bin: angle 0 straight ahead, negative to the left
+void PolarToUnit(const Bin &b, int maxCm, double &x, double &y) {
+    const double r = std::min<double>(b.distanceCm, maxCm) / maxCm;
+    const double a = b.angleDeg * kPi / 180.0;
+    x = r * std::sin(a);
+    y = r * std::cos(a);
+}
+
+void DrawTerminal(const ScanView &view, const Options &opt, const scan::FrameReader &reader) {
+    const int width = 2 * kPlotRadius + 1;
+    const int height = kPlotRadius / 2 + 1;   // Characters are about twice as tall as wide
+    std::vector<std::string> grid(height, std::string(width, ' '));
+
+    for (int deg = -90; deg <= 90; deg += 3) {            // Range rings at 50% and 100%
+        for (double ring : {0.5, 1.0}) {
+            const double a = deg * kPi / 180.0;
+            const int col = int(std::lround(kPlotRadius + ring * kPlotRadius * std::sin(a)));
+            const int row = height - 1 - int(std::lround(ring * (height - 1) * std::cos(a)));
+            grid[row][col] = '.';
+        }
+    }
+    grid[height - 1][kPlotRadius] = '^';
+
+    for (const Bin &b : view.bins) {
+        if (b.distanceCm == scan::kNoEcho) continue;
+        double x, y;
+        PolarToUnit(b, opt.maxCm, x, y);
+        const int col = int(std::lround(kPlotRadius + x * kPlotRadius));
+        const int row = height - 1 - int(std::lround(y * (height - 1)));
+        grid[row][col] = b.distanceCm > opt.maxCm ? '+' : '#';
+    }
+
+    std::string out = "\x1B[H\x1B[2J";
+    char line[160];
+    std::snprintf(line, sizeof(line), "%s scan %u  %.2f C  bins %zu/%u  range %d..%d deg  edge %d cm\n",
+                  opt.label.c_str(), view.begin.scanId, view.begin.tempCentiC / 100.0,
+                  view.bins.size(), view.begin.bins, view.begin.fromDeg, view.begin.toDeg, opt.maxCm);
+    out += line;
+    for (const std::string &row : grid) {
+        out += row;
+        out += '\n';
+    }
+    if (view.ended) {
+        if (view.end.detected) {
+            std::snprintf(line, sizeof(line), "object at %d deg, %u cm\n", view.end.angleDeg, view.end.distanceCm);
+        } else {
+            std::snprintf(line, sizeof(line), "no object\n");
+        }
+        out += line;
+    } else {
+        out += "scanning...\n";
+    }
+    std::snprintf(line, sizeof(line), "packets %llu  bad frames %llu\n",
+                  (unsigned long long)reader.packets, (unsigned long long)reader.badFrames);
+    out += line;
+    std::fwrite(out.data(), 1, out.size(), stdout);
+    std::fflush(stdout);
+}
+
+void WriteImage(const ScanView &view, const Options &opt) {
+    const int w = 2 * kImageRadius + 1;
+    const int h = kImageRadius + 1;
+    std::vector<uint8_t> rgb(size_t(w) * h * 3, 255);
+
+    auto plot = [&](int x, int y, uint8_t r, uint8_t g, uint8_t b) {
+        if (x < 0 || x >= w || y < 0 || y >= h) return;
+        uint8_t *p = &rgb[(size_t(y) * w + x) * 3];
+        p[0] = r;
+        p[1] = g;
+        p[2] = b;
+    };
+
+    for (int i = 0; i <= 720; i++) {                       // Rings every 25%
+        const double a = (i / 4.0 - 90.0) * kPi / 180.0;
+        for (double ring : {0.25, 0.5, 0.75, 1.0}) {
+            plot(int(std::lround(kImageRadius + ring * kImageRadius * std::sin(a))),
+                 int(std::lround(h - 1 - ring * kImageRadius * std::cos(a))), 200, 200, 200);
+        }
+    }
+    for (const Bin &b : view.bins) {
+        if (b.distanceCm == scan::kNoEcho || b.distanceCm > opt.maxCm) continue;
+        double x, y;
+        PolarToUnit(b, opt.maxCm, x, y);
+        const int px = int(std::lround(kImageRadius + x * kImageRadius));
+        const int py = int(std::lround(h - 1 - y * kImageRadius));
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) plot(px + dx, py + dy, 220, 0, 0);
+        }
+    }
+
+    const std::string path = opt.imageDir + "/scan_" + std::to_string(view.begin.scanId) + ".ppm";
+    FILE *f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        std::cerr << "cannot write " << path << '\n';
+        return;
+    }
+    std::fprintf(f, "P6\n%d %d\n255\n", w, h);
+    std::fwrite(rgb.data(), 1, rgb.size(), f);
+    std::fclose(f);
+}
+
+void Usage(const char *argv0) {
+    std::cerr << "usage: " << argv0 << " [-b baud] [-r max_cm] [-o image_dir] [-q] [-l label] <device|file|->\n";
+    std::exit(2);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Options opt;
+    int c;
+    while ((c = getopt(argc, argv, "b:r:o:ql:")) != -1) {
+        switch (c) {
+        case 'b': opt.baud = std::strtoul(optarg, nullptr, 10); break;
+        case 'r': opt.maxCm = std::atoi(optarg); break;
+        case 'o': opt.imageDir = optarg; break;
+        case 'q': opt.quiet = true; break;
+        case 'l': opt.label = optarg; break;
+        default: Usage(argv[0]);
+        }
+    }
+    if (optind != argc - 1 || opt.maxCm <= 0) Usage(argv[0]);
+    opt.input = argv[optind];
+    if (opt.label.empty()) opt.label = opt.input;
+
+    int fd;
+    try {
+        fd = scan::OpenScanInput(opt.input, opt.baud);
+    } catch (const std::exception &e) {
+        std::cerr << argv[0] << ": " << e.what() << '\n';
+        return 1;
+    }
+
+    scan::FrameReader reader;
+    ScanView view;
+    auto lastDraw = std::chrono::steady_clock::now();
+    const auto drawInterval = std::chrono::milliseconds(50);
+
+    auto handle = [&](const scan::Packet &pkt) {
+        bool redraw = false;
+        switch (pkt.type) {
+        case scan::kPacketBegin:
+            view = ScanView();
+            view.active = true;
+            view.begin = pkt;
+            redraw = true;
+            break;
+        case scan::kPacketBin:
+            if (!view.active || pkt.scanId != view.begin.scanId) return;   // Joined mid-scan
+            view.bins.push_back(Bin{pkt.angleDeg, pkt.distanceCm});
+            break;
+        case scan::kPacketEnd:
+            if (!view.active || pkt.scanId != view.begin.scanId) return;
+            view.ended = true;
+            view.end = pkt;
+            if (!opt.imageDir.empty()) WriteImage(view, opt);
+            redraw = true;
+            break;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (!opt.quiet && (redraw || now - lastDraw >= drawInterval)) {
+            DrawTerminal(view, opt, reader);
+            lastDraw = now;
+        }
+    };
+
+    uint8_t buf[4096];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+        reader.Feed(buf, size_t(n), handle);
+    }
+    if (opt.quiet) {
+        std::cerr << "packets " << reader.packets << ", bad frames " << reader.badFrames << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+// serial_input.h
+// Opens the device's UART0 output for the host tools: a serial port (set to
+// raw mode at the given baud), a pty, a capture file, or "-" for stdin.
+
+#ifndef SERIAL_INPUT_H
+#define SERIAL_INPUT_H
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace scan {
+
+inline speed_t BaudConstant(uint32_t baud) {
+    switch (baud) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+#ifdef B460800
+    case 460800: return B460800;
+#endif
+#ifdef B921600
+    case 921600: return B921600;
+#endif
+#ifdef B1000000
+    case 1000000: return B1000000;
+#endif
+    default: throw std::runtime_error("unsupported baud rate " + std::to_string(baud));
+    }
+}
+
+// Returns a file descriptor to read(); throws on failure
+inline int OpenScanInput(const std::string &path, uint32_t baud) {
+    if (path == "-") return STDIN_FILENO;
+
+    const int fd = open(path.c_str(), O_RDONLY | O_NOCTTY);
+    if (fd < 0) throw std::runtime_error("cannot open " + path);
+
+    if (isatty(fd)) {
+        termios tio;
+        if (tcgetattr(fd, &tio) != 0) {
+            close(fd);
+            throw std::runtime_error("tcgetattr failed on " + path);
+        }
+        cfmakeraw(&tio);
+        tio.c_cflag |= CLOCAL | CREAD;
+        tio.c_cc[VMIN] = 1;
+        tio.c_cc[VTIME] = 0;
+        const speed_t speed = BaudConstant(baud);
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+        if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+            close(fd);
+            throw std::runtime_error("tcsetattr failed on " + path);
+        }
+    }
+    return fd;
+}
+
+}  // namespace scan
+
+#endif  // SERIAL_INPUT_H
@@ -0,0 +1,160 @@
+// TM4C123.h (host tests)
+// Stand-in for the CMSIS device header when the firmware headers are
+// compiled on the host by host/CMakeLists.txt.
+//
+// The core peripherals keep their CMSIS layout and addresses, and
+// tm4c123gh6pm.h register macros keep their absolute addresses:
+// target_stub.c maps the peripheral (0x40000000) and system (0xE0000000)
+// regions as plain memory before main(), so firmware code reads and writes
+// "registers" and a test sets or inspects them directly. No hardware
+// behaviour is simulated.
+//
+// The NVIC calls act on the mapped NVIC registers (set-enable and pending
+// bits just stay set until cleared), and BASEPRI, PRIMASK and IPSR are
+// plain variables a test may set to play an ISR or a critical section.
+
+#ifndef TM4C123_H
+#define TM4C123_H
+
+#include <stdint.h>
+
+#define __IO volatile
+#define __I  volatile
+#define __O  volatile
+
+#define __NVIC_PRIO_BITS 3
+
+typedef enum {
+    NonMaskableInt_IRQn = -14, HardFault_IRQn = -13, MemoryManagement_IRQn = -12,
+    BusFault_IRQn = -11, UsageFault_IRQn = -10, SVCall_IRQn = -5, DebugMonitor_IRQn = -4,
+    PendSV_IRQn = -2, SysTick_IRQn = -1,
+    GPIOA_IRQn = 0, GPIOB_IRQn = 1, GPIOC_IRQn = 2, GPIOD_IRQn = 3, GPIOE_IRQn = 4,
+    UART0_IRQn = 5, UART1_IRQn = 6, SSI0_IRQn = 7, I2C0_IRQn = 8,
+    TIMER0A_IRQn = 19, TIMER1A_IRQn = 21, TIMER2A_IRQn = 23, COMP0_IRQn = 25,
+    SYSCTL_IRQn = 28, GPIOF_IRQn = 30, UDMA_IRQn = 46, UDMAERR_IRQn = 47,
+    TIMER4A_IRQn = 70, TIMER5A_IRQn = 92, WTIMER0A_IRQn = 94, WTIMER0B_IRQn = 95,
+    WTIMER1A_IRQn = 96, WTIMER1B_IRQn = 97
+} IRQn_Type;
+
+// ==================== Core Peripherals (CMSIS layout) ====================
+
+typedef struct {
+    __IO uint32_t ISER[8];  uint32_t RESERVED0[24];
+    __IO uint32_t ICER[8];  uint32_t RESERVED1[24];
+    __IO uint32_t ISPR[8];  uint32_t RESERVED2[24];
+    __IO uint32_t ICPR[8];  uint32_t RESERVED3[24];
+    __IO uint32_t IABR[8];  uint32_t RESERVED4[56];
+    __IO uint8_t  IP[240];  uint32_t RESERVED5[644];
+    __O  uint32_t STIR;
+} NVIC_Type;
+
+typedef struct {
+    __I  uint32_t CPUID;
+    __IO uint32_t ICSR, VTOR, AIRCR, SCR, CCR;
+    __IO uint8_t  SHP[12];
+    __IO uint32_t SHCSR, CFSR, HFSR, DFSR, MMFAR, BFAR, AFSR;
+    __I  uint32_t PFR[2], DFR, ADR, MMFR[4], ISAR[5];
+    uint32_t RESERVED0[5];
+    __IO uint32_t CPACR;
+} SCB_Type;
+
+typedef struct {
+    __IO uint32_t CTRL, LOAD, VAL;
+    __I  uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct {
+    __IO uint32_t CTRL, CYCCNT, CPICNT, EXCCNT, SLEEPCNT, LSUCNT, FOLDCNT;
+    __I  uint32_t PCSR;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t DHCSR;
+    __O  uint32_t DCRSR;
+    __IO uint32_t DCRDR, DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    uint32_t RESERVED0;
+    __IO uint32_t FPCCR, FPCAR, FPDSCR;
+    __I  uint32_t MVFR0, MVFR1;
+} FPU_Type;
+
+#define SysTick   ((SysTick_Type   *)0xE000E010UL)
+#define NVIC      ((NVIC_Type      *)0xE000E100UL)
+#define SCB       ((SCB_Type       *)0xE000ED00UL)
+#define CoreDebug ((CoreDebug_Type *)0xE000EDF0UL)
+#define FPU       ((FPU_Type       *)0xE000EF30UL)
+#define DWT       ((DWT_Type       *)0xE0001000UL)
+
+#define SCB_ICSR_PENDSVSET_Msk     (1UL << 28)
+#define SCB_SCR_SLEEPONEXIT_Msk    (1UL << 1)
+#define SCB_SCR_SLEEPDEEP_Msk      (1UL << 2)
+#define SysTick_CTRL_ENABLE_Msk    (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk   (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk (1UL << 2)
+#define DWT_CTRL_CYCCNTENA_Msk     (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+#define FPU_FPCCR_LSPEN_Msk        (1UL << 30)
+#define FPU_FPCCR_ASPEN_Msk        (1UL << 31)
+
+extern uint32_t SystemCoreClock;
+void SystemCoreClockUpdate(void);
+
+// ==================== Core State ====================
+// What the intrinsics below read and write; set by tests
+
+extern uint32_t hostBasepri;
+extern uint32_t hostPrimask;
+extern uint32_t hostIpsr;          // Nonzero: "in handler mode"
+
+// ==================== NVIC ====================
+
+static inline void NVIC_EnableIRQ(IRQn_Type n)       { NVIC->ISER[n >> 5] |= 1UL << (n & 31); }
+static inline void NVIC_DisableIRQ(IRQn_Type n)      { NVIC->ISER[n >> 5] &= ~(1UL << (n & 31)); }
+static inline void NVIC_SetPendingIRQ(IRQn_Type n)   { NVIC->ISPR[n >> 5] |= 1UL << (n & 31); }
+static inline void NVIC_ClearPendingIRQ(IRQn_Type n) { NVIC->ISPR[n >> 5] &= ~(1UL << (n & 31)); }
+static inline uint32_t NVIC_GetPendingIRQ(IRQn_Type n) {
+    return (NVIC->ISPR[n >> 5] >> (n & 31)) & 1;
+}
+static inline void NVIC_SetPriority(IRQn_Type n, uint32_t p) {
+    uint8_t value = (uint8_t)(p << (8 - __NVIC_PRIO_BITS));
+    if (n < 0) SCB->SHP[(n & 0xF) - 4] = value;
+    else       NVIC->IP[n] = value;
+}
+static inline uint32_t NVIC_GetPriority(IRQn_Type n) {
+    return (n < 0 ? SCB->SHP[(n & 0xF) - 4] : NVIC->IP[n]) >> (8 - __NVIC_PRIO_BITS);
+}
+static inline void NVIC_SetPriorityGrouping(uint32_t g) { (void)g; }
+
+// ==================== Intrinsics ====================
+
+static inline void __WFI(void) {}
+static inline void __WFE(void) {}
+static inline void __SEV(void) {}
+static inline void __NOP(void) {}
+static inline void __DMB(void) { __sync_synchronize(); }
+static inline void __DSB(void) { __sync_synchronize(); }
+static inline void __ISB(void) { __sync_synchronize(); }
+
+static inline void __enable_irq(void)           { hostPrimask = 0; }
+static inline void __disable_irq(void)          { hostPrimask = 1; }
+static inline uint32_t __get_PRIMASK(void)      { return hostPrimask; }
+static inline void __set_PRIMASK(uint32_t v)    { hostPrimask = v & 1; }
+static inline uint32_t __get_BASEPRI(void)      { return hostBasepri; }
+static inline void __set_BASEPRI(uint32_t v)    { hostBasepri = v & 0xFF; }
+static inline void __set_BASEPRI_MAX(uint32_t v) {
+    v &= 0xFF;
+    if (v && (hostBasepri == 0 || v < hostBasepri)) hostBasepri = v;   // Only ever raises the mask
+}
+static inline uint32_t __get_IPSR(void)         { return hostIpsr; }
+
+static inline uint32_t __LDREXW(volatile uint32_t *p)             { return *p; }
+static inline uint32_t __STREXW(uint32_t v, volatile uint32_t *p) { *p = v; return 0; }
+static inline void __CLREX(void) {}
+static inline uint8_t __CLZ(uint32_t v) { return v ? (uint8_t)__builtin_clz(v) : 32; }
+
+#define __STATIC_INLINE      static inline
+#define __STATIC_FORCEINLINE static inline
+
+#endif // TM4C123_H
@@ -0,0 +1,31 @@
+// check.h
+// Minimal assertions for the host tests: CHECK() reports every failure with
+// its location and keeps going, CHECK_DONE() turns the count into the exit
+// status ctest looks at.
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+        checkFailures++; \
+    } \
+} while (0)
+
+#define CHECK_EQ(a, b) do { \
+    long long checkA = (long long)(a), checkB = (long long)(b); \
+    if (checkA != checkB) { \
+        fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", \
+                __FILE__, __LINE__, #a, #b, checkA, checkB); \
+        checkFailures++; \
+    } \
+} while (0)
+
+#define CHECK_DONE() (checkFailures ? (fprintf(stderr, "%d check(s) failed\n", checkFailures), 1) : 0)
+
+#endif // CHECK_H
@@ -0,0 +1,8 @@
+// spsc_bad_capacity.c
+// Must not compile: SPSC_DEFINE rejects a capacity that is not a power of
+// two (the slot mask would skip records). Built by the
+// test_spsc_bad_capacity test, which expects the compiler to fail.
+
+#include "spsc.h"
+
+SPSC_DEFINE(badRing, uint8_t, 6);
@@ -0,0 +1,49 @@
+// target_stub.c
+// Host stand-ins for what the firmware gets from the device: the register
+// regions, SystemCoreClock and the core state behind the intrinsics in
+// test/TM4C123.h. Linked into every host test.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+#include "TM4C123.h"
+
+uint32_t SystemCoreClock = 80000000;   // Clock_Init's PLL setting
+uint32_t hostBasepri = 0;
+uint32_t hostPrimask = 0;
+uint32_t hostIpsr = 0;
+
+void SystemCoreClockUpdate(void) {
+}
+
+// Map one register region as zeroed memory at its real address
+static void Host_MapRegion(uintptr_t base, size_t size) {
+    void *p = mmap((void *)base, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (p != (void *)base) {
+        fprintf(stderr, "target_stub: cannot map registers at 0x%08lx\n", (unsigned long)base);
+        exit(2);
+    }
+}
+
+// Before main(): register addresses must be valid before any test runs
+__attribute__((constructor)) static void Host_MapRegisters(void) {
+    Host_MapRegion(0x40000000UL, 0x00100000UL);   // APB/AHB peripherals, SYSCTL, uDMA
+    Host_MapRegion(0xE0000000UL, 0x00100000UL);   // DWT, SysTick, NVIC, SCB
+}
+
+// UART output used by profile.h; a test that includes printHelper.h links
+// the real ones instead
+__attribute__((weak)) void printChar(char c) {
+    putchar(c);
+}
+
+__attribute__((weak)) void printString(const char *str) {
+    fputs(str, stdout);
+}
+
+__attribute__((weak)) void printInt(uint32_t num) {
+    printf("%lu", (unsigned long)num);
+}
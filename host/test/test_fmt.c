@@ -0,0 +1,155 @@
+// test_fmt.c
+// Host test for the number formatter (fmt.h) against the C library printf.
+//
+// Integers and fixed-point values must match printf exactly. Fmt_Float
+// scales in single precision, so it is compared with printf of the same
+// float wherever the decimal value is not within float rounding of a .5
+// tie; ties round half away from zero where printf rounds to even.
+//
+// Also prints a host timing of Fmt_Float against snprintf("%.2f"). These
+// are x86-64 numbers, not Cortex-M4 cycles.
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fmt.h"
+#include "check.h"
+
+static char got[64], want[64];
+
+#define CHECK_STR(expr, ...) do { \
+    snprintf(want, sizeof(want), __VA_ARGS__); \
+    expr; \
+    if (strcmp(got, want) != 0) { \
+        fprintf(stderr, "%s:%d: %s gave \"%s\", printf \"%s\"\n", __FILE__, __LINE__, #expr, got, want); \
+        checkFailures++; \
+    } \
+} while (0)
+
+static uint32_t rng = 12345;
+
+static uint32_t Random(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static void TestIntegers(void) {
+    static const int32_t edge[] = { 0, 1, -1, 9, 10, -10, 99999, INT32_MAX, INT32_MIN, INT32_MIN + 1 };
+
+    for (unsigned i = 0; i < sizeof(edge) / sizeof(edge[0]); i++) {
+        int32_t v = edge[i];
+        CHECK_STR(Fmt_Int(got, v, 0, ' '), "%ld", (long)v);
+        CHECK_STR(Fmt_Int(got, v, 8, ' '), "%8ld", (long)v);
+        CHECK_STR(Fmt_Int(got, v, 8, '0'), "%08ld", (long)v);
+        CHECK_STR(Fmt_Uint(got, (uint32_t)v, 12, ' '), "%12lu", (unsigned long)(uint32_t)v);
+    }
+    for (int i = 0; i < 100000; i++) {
+        int32_t v = (int32_t)Random() >> (Random() % 32);
+        uint8_t width = (uint8_t)(Random() % 14);
+        CHECK_STR(Fmt_Int(got, v, width, '0'), "%0*ld", width, (long)v);
+        CHECK_STR(Fmt_Uint(got, (uint32_t)v, width, ' '), "%*lu", width, (unsigned long)(uint32_t)v);
+        if (checkFailures) return;
+    }
+}
+
+static void TestFixed(void) {
+    CHECK_STR(Fmt_Fixed(got, 2005, 2), "20.05");
+    CHECK_STR(Fmt_Fixed(got, -5, 2), "-0.05");
+    CHECK_STR(Fmt_Fixed(got, INT32_MIN, 9), "-2.147483648");
+    CHECK_STR(Fmt_Fixed(got, 7, 0), "7");
+    for (int i = 0; i < 100000; i++) {
+        int32_t v = (int32_t)Random();
+        uint8_t decimals = (uint8_t)(Random() % (FMT_MAX_DECIMALS + 1));
+        long long p = 1;
+        for (int k = 0; k < decimals; k++) p *= 10;
+        long long mag = llabs((long long)v);
+        if (decimals) {
+            CHECK_STR(Fmt_Fixed(got, v, decimals), "%s%lld.%0*lld", v < 0 ? "-" : "",
+                      mag / p, decimals, mag % p);
+        } else {
+            CHECK_STR(Fmt_Fixed(got, v, decimals), "%ld", (long)v);
+        }
+        if (checkFailures) return;
+    }
+}
+
+static void TestFloatSpecial(void) {
+    CHECK_STR(Fmt_Float(got, NAN, 2), "nan");
+    CHECK_STR(Fmt_Float(got, INFINITY, 2), "inf");
+    CHECK_STR(Fmt_Float(got, -INFINITY, 2), "-inf");
+    CHECK_STR(Fmt_Float(got, 3.0e9f, 0), "ovf");          // Past 2^31: no clamped number
+    CHECK_STR(Fmt_Float(got, -25000000.0f, 2), "-ovf");
+    CHECK_STR(Fmt_Float(got, FLT_MAX, 1), "ovf");
+    CHECK_STR(Fmt_Float(got, 2147483520.0f, 0), "2147483520");
+    CHECK_STR(Fmt_Float(got, 20.05f, 2), "20.05");
+    CHECK_STR(Fmt_Float(got, -0.004f, 2), "0.00");         // Rounds to zero: no "-0.00"
+    CHECK_STR(Fmt_Float(got, 0.125f, 2), "0.13");          // Exact tie: away from zero
+    CHECK_STR(Fmt_Float(got, -2.5f, 0), "-3");
+}
+
+// Random floats. Below 2^14 once scaled, single-precision scaling is off by
+// at most 0.001 of the last digit, so away from ties the output is exact;
+// above that the last digits are only as good as the float's 24 bits.
+static void TestFloatRandom(void) {
+    for (int i = 0; i < 200000; i++) {
+        uint8_t decimals = (uint8_t)(Random() % 5);
+        float v = (float)((int32_t)Random()) / (float)(1u << (Random() % 31));
+        double exact = (double)v * pow(10, decimals);      // Exact in double for these ranges
+        double frac = fabs(exact - trunc(exact));
+
+        if (fabs(exact) < 0.5 || fabs(exact) > FMT_FLOAT_LIMIT) continue;   // "-0.00", "ovf"
+        if (fabs(exact) < 16384.0) {
+            if (fabs(frac - 0.5) < 2e-3) continue;                           // Tie
+            CHECK_STR(Fmt_Float(got, v, decimals), "%.*f", decimals, (double)v);
+        } else {
+            Fmt_Float(got, v, decimals);
+            snprintf(want, sizeof(want), "%.*f", decimals, (double)v);
+            double error = fabs(strtod(got, 0) - strtod(want, 0)) * pow(10, decimals);
+            CHECK(error < 1.001 + fabs(exact) / (1 << 23));   // One digit plus two float ulps
+        }
+        if (checkFailures) return;
+    }
+}
+
+static double Seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// ns per call on this host; printed for the record, not checked
+static void BenchFloat(void) {
+    enum { N = 2000000 };
+    volatile char sink = 0;
+    double t0, fmtNs, printfNs;
+
+    t0 = Seconds();
+    for (int i = 0; i < N; i++) {
+        Fmt_Float(got, 20.0f + (float)(i & 1023) * 0.01f, 2);
+        sink ^= got[0];
+    }
+    fmtNs = (Seconds() - t0) * 1e9 / N;
+    t0 = Seconds();
+    for (int i = 0; i < N; i++) {
+        snprintf(got, sizeof(got), "%.2f", (double)(20.0f + (float)(i & 1023) * 0.01f));
+        sink ^= got[0];
+    }
+    printfNs = (Seconds() - t0) * 1e9 / N;
+    printf("host: Fmt_Float %.1f ns/call, snprintf(\"%%.2f\") %.1f ns/call\n", fmtNs, printfNs);
+    (void)sink;
+}
+
+int main(void) {
+    TestIntegers();
+    TestFixed();
+    TestFloatSpecial();
+    TestFloatRandom();
+    BenchFloat();
+    return CHECK_DONE();
+}
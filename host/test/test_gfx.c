@@ -0,0 +1,266 @@
+// test_gfx.c
+// Host test and timing harness for the framebuffer graphics (gfx.h).
+//
+// Screen and Nokia5110_MarkDirty are provided here: Screen is a plain 504
+// byte buffer and the dirty marks are kept per bank, so every primitive can
+// be checked pixel by pixel against a straightforward reference renderer
+// on a 2D array, including clipping, and its dirty marks can be checked to
+// cover every byte it changed.
+//
+// The timing section prints host ns per call (x86-64, not Cortex-M4
+// cycles; PROF_DYNAMIC_PLOT measures the target) for each primitive next to
+// the per-pixel loop it replaced.
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gfx.h"
+#include "check.h"
+
+// ==================== Screen Stand-In ====================
+
+static uint8_t screenBuffer[GFX_WIDTH * GFX_BANKS];
+uint8_t *Screen = screenBuffer;
+
+static int32_t dirtyLo[GFX_BANKS], dirtyHi[GFX_BANKS];   // Empty when lo > hi
+static uint32_t dirtyCalls;
+
+void Nokia5110_MarkDirty(uint32_t bank, uint32_t x0, uint32_t x1) {
+    CHECK(bank < GFX_BANKS && x0 <= x1 && x1 < GFX_WIDTH);
+    if (bank >= GFX_BANKS) return;
+    if ((int32_t)x0 < dirtyLo[bank]) dirtyLo[bank] = (int32_t)x0;
+    if ((int32_t)x1 > dirtyHi[bank]) dirtyHi[bank] = (int32_t)x1;
+    dirtyCalls++;
+}
+
+// ==================== Reference Renderer ====================
+
+static uint8_t ref[GFX_HEIGHT][GFX_WIDTH];
+
+static uint32_t rng = 2024;
+
+static uint32_t Random(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static int32_t RandomIn(int32_t lo, int32_t hi) {
+    return lo + (int32_t)(Random() % (uint32_t)(hi - lo + 1));
+}
+
+// Random picture in both Screen and ref, dirty marks cleared
+static void Start(void) {
+    for (int32_t y = 0; y < GFX_HEIGHT; y++) {
+        for (int32_t x = 0; x < GFX_WIDTH; x++) {
+            ref[y][x] = Random() & 1;
+        }
+    }
+    for (int32_t bank = 0; bank < GFX_BANKS; bank++) {
+        for (int32_t x = 0; x < GFX_WIDTH; x++) {
+            uint8_t byte = 0;
+            for (int32_t bit = 0; bit < 8; bit++) byte |= (uint8_t)(ref[8 * bank + bit][x] << bit);
+            Screen[GFX_WIDTH * bank + x] = byte;
+        }
+        dirtyLo[bank] = GFX_WIDTH;
+        dirtyHi[bank] = -1;
+    }
+}
+
+static void RefPlot(int32_t x, int32_t y, uint8_t color) {
+    if (x < 0 || y < 0 || x >= GFX_WIDTH || y >= GFX_HEIGHT) return;
+    ref[y][x] = (color == GFX_SET) ? 1 : (color == GFX_CLEAR) ? 0 : !ref[y][x];
+}
+
+// Screen equals ref, and every changed byte is inside its bank's dirty span
+static int Compare(const char *what, const uint8_t *before) {
+    int bad = 0;
+    for (int32_t y = 0; y < GFX_HEIGHT; y++) {
+        for (int32_t x = 0; x < GFX_WIDTH; x++) {
+            if (((Screen[GFX_WIDTH * (y >> 3) + x] >> (y & 7)) & 1) != ref[y][x]) bad++;
+        }
+    }
+    for (int32_t i = 0; i < GFX_WIDTH * GFX_BANKS; i++) {
+        int32_t bank = i / GFX_WIDTH, x = i % GFX_WIDTH;
+        if (Screen[i] != before[i] && (x < dirtyLo[bank] || x > dirtyHi[bank])) bad++;
+    }
+    if (bad) fprintf(stderr, "%s: %d pixel/dirty mismatches\n", what, bad);
+    CHECK_EQ(bad, 0);
+    return bad;
+}
+
+// Pixels of an unclipped Bresenham line: endpoints included, one pixel per
+// step of the major axis, each within half a pixel of the true line on the
+// minor axis. Returns the pixel count.
+static int32_t RefLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t *px, int32_t *py) {
+    int32_t dx = abs(x1 - x0), dy = abs(y1 - y0);
+    int32_t steps = dx > dy ? dx : dy;
+    for (int32_t i = 0; i <= steps; i++) {
+        // Along the major axis; minor rounded from exact rational position
+        int64_t num, den = steps ? steps : 1;
+        if (dx >= dy) {
+            px[i] = x0 + (x1 > x0 ? i : -i);
+            num = (int64_t)(y1 - y0) * i;
+            py[i] = y0 + (int32_t)((2 * num + (num >= 0 ? den : -den)) / (2 * den));
+        } else {
+            py[i] = y0 + (y1 > y0 ? i : -i);
+            num = (int64_t)(x1 - x0) * i;
+            px[i] = x0 + (int32_t)((2 * num + (num >= 0 ? den : -den)) / (2 * den));
+        }
+    }
+    return steps + 1;
+}
+
+// ==================== Tests ====================
+
+static void TestFills(void) {
+    uint8_t before[sizeof(screenBuffer)];
+    for (int i = 0; i < 20000 && !checkFailures; i++) {
+        int32_t x0 = RandomIn(-20, 100), x1 = RandomIn(-20, 100);
+        int32_t y0 = RandomIn(-20, 60), y1 = RandomIn(-20, 60);
+        uint8_t color = (uint8_t)(Random() % 3);
+
+        Start();
+        memcpy(before, Screen, sizeof(before));
+        switch (i % 4) {
+        case 0:
+            Gfx_FillRect(x0, y0, x1, y1, color);
+            for (int32_t y = y0 < y1 ? y0 : y1; y <= (y0 < y1 ? y1 : y0); y++)
+                for (int32_t x = x0 < x1 ? x0 : x1; x <= (x0 < x1 ? x1 : x0); x++) RefPlot(x, y, color);
+            Compare("Gfx_FillRect", before);
+            break;
+        case 1:
+            Gfx_HLine(x0, x1, y0, color);
+            for (int32_t x = x0 < x1 ? x0 : x1; x <= (x0 < x1 ? x1 : x0); x++) RefPlot(x, y0, color);
+            Compare("Gfx_HLine", before);
+            break;
+        case 2:
+            Gfx_VLine(x0, y0, y1, color);
+            for (int32_t y = y0 < y1 ? y0 : y1; y <= (y0 < y1 ? y1 : y0); y++) RefPlot(x0, y, color);
+            Compare("Gfx_VLine", before);
+            break;
+        default:
+            Gfx_Pixel(x0, y0, color);
+            RefPlot(x0, y0, color);
+            Compare("Gfx_Pixel", before);
+            break;
+        }
+    }
+}
+
+// Pixel-exact against RefLine, clipped, for lines with ends far off screen.
+// Exact .5 ties on the minor axis may go either way, so those lines are
+// checked for pixel count and endpoints only.
+static void TestLines(void) {
+    static int32_t px[1024], py[1024];
+    uint8_t before[sizeof(screenBuffer)];
+
+    for (int i = 0; i < 20000 && !checkFailures; i++) {
+        int32_t range = (i & 1) ? 300 : 40;
+        int32_t x0 = RandomIn(-range, GFX_WIDTH + range), x1 = RandomIn(-range, GFX_WIDTH + range);
+        int32_t y0 = RandomIn(-range, GFX_HEIGHT + range), y1 = RandomIn(-range, GFX_HEIGHT + range);
+        int32_t dx = abs(x1 - x0), dy = abs(y1 - y0);
+        int32_t major = dx > dy ? dx : dy, minor = dx > dy ? dy : dx;
+        int tie = 0;
+        for (int32_t k = 1; k < major && !tie; k++) {
+            tie = (2 * (int64_t)minor * k) % (2 * major) == major;   // Minor at exactly .5
+        }
+
+        Start();
+        memcpy(before, Screen, sizeof(before));
+        Gfx_Line(x0, y0, x1, y1, GFX_INVERT);
+        int32_t n = RefLine(x0, y0, x1, y1, px, py);
+        if (!tie) {
+            for (int32_t k = 0; k < n; k++) RefPlot(px[k], py[k], GFX_INVERT);
+            Compare("Gfx_Line", before);
+        } else if (x0 >= 0 && x1 >= 0 && y0 >= 0 && y1 >= 0 &&
+                   x0 < GFX_WIDTH && x1 < GFX_WIDTH && y0 < GFX_HEIGHT && y1 < GFX_HEIGHT) {
+            // One distinct pixel per major step: INVERT flips exactly n bits
+            int32_t changed = 0;
+            for (int32_t b = 0; b < (int32_t)sizeof(before); b++) {
+                changed += __builtin_popcount((unsigned)(Screen[b] ^ before[b]));
+            }
+            CHECK_EQ(changed, n);
+            CHECK((Screen[GFX_WIDTH * (y0 >> 3) + x0] ^ before[GFX_WIDTH * (y0 >> 3) + x0]) >> (y0 & 7) & 1);
+            CHECK((Screen[GFX_WIDTH * (y1 >> 3) + x1] ^ before[GFX_WIDTH * (y1 >> 3) + x1]) >> (y1 & 7) & 1);
+        }
+    }
+}
+
+// Full and partial midpoint circles
+static void TestArcs(void) {
+    uint8_t before[sizeof(screenBuffer)];
+
+    for (int32_t r = 1; r < 30; r++) {
+        Start();
+        memset(Screen, 0, sizeof(screenBuffer));
+        memcpy(before, Screen, sizeof(before));
+        Gfx_Arc(41, 23, r, 0, 360, GFX_SET);
+        int32_t lit = 0;
+        for (int32_t y = 0; y < GFX_HEIGHT; y++) {
+            for (int32_t x = 0; x < GFX_WIDTH; x++) {
+                if (!((Screen[GFX_WIDTH * (y >> 3) + x] >> (y & 7)) & 1)) continue;
+                int32_t d = (x - 41) * (x - 41) + (y - 23) * (y - 23) - r * r;
+                CHECK(d <= r && d >= -r);          // Within half a pixel of the circle
+                int32_t mx = 82 - x, my = 46 - y;  // Symmetric about the centre
+                if (mx >= 0 && my >= 0 && mx < GFX_WIDTH && my < GFX_HEIGHT) {
+                    CHECK((Screen[GFX_WIDTH * (my >> 3) + mx] >> (my & 7)) & 1);
+                }
+                lit++;
+            }
+        }
+        if (r < 23) CHECK(lit >= 4 * r);           // Closed ring: at least one pixel per step
+        for (int32_t i = 0; i < (int32_t)sizeof(before); i++) {
+            int32_t bank = i / GFX_WIDTH, x = i % GFX_WIDTH;
+            if (Screen[i] != before[i]) CHECK(x >= dirtyLo[bank] && x <= dirtyHi[bank]);
+        }
+    }
+
+    // The scan's upper half: nothing below the centre row
+    memset(Screen, 0, sizeof(screenBuffer));
+    Gfx_Arc(41, 40, 20, -90, 90, GFX_SET);
+    for (int32_t y = 41; y < GFX_HEIGHT; y++) {
+        for (int32_t x = 0; x < GFX_WIDTH; x++) {
+            CHECK(!((Screen[GFX_WIDTH * (y >> 3) + x] >> (y & 7)) & 1));
+        }
+    }
+    CHECK((Screen[GFX_WIDTH * (20 >> 3) + 41] >> (20 & 7)) & 1);   // Top of the arc
+}
+
+// ==================== Timing ====================
+
+static double Seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+#define TIME(label, n, body) do { \
+    double t0 = Seconds(); \
+    for (int32_t it = 0; it < (n); it++) { body; } \
+    printf("host: %-34s %8.1f ns\n", label, (Seconds() - t0) * 1e9 / (n)); \
+} while (0)
+
+static void Bench(void) {
+    enum { N = 200000 };
+    TIME("Gfx_FillRect 40x20", N, Gfx_FillRect(10, 10, 49, 29, GFX_INVERT));
+    TIME("  per-pixel Gfx_Pixel 40x20", N / 10,
+         for (int32_t y = 10; y < 30; y++) for (int32_t x = 10; x < 50; x++) Gfx_Pixel(x, y, GFX_INVERT));
+    TIME("Gfx_VLine 48", N, Gfx_VLine(it % GFX_WIDTH, 0, 47, GFX_INVERT));
+    TIME("  per-pixel Gfx_Pixel 48", N,
+         for (int32_t y = 0; y < 48; y++) Gfx_Pixel(it % GFX_WIDTH, y, GFX_INVERT));
+    TIME("Gfx_Line 83x47 diagonal", N, Gfx_Line(0, 0, 83, 47, GFX_INVERT));
+    TIME("Gfx_Line clipped (-200..300)", N, Gfx_Line(-200, -100, 300, 150, GFX_INVERT));
+    TIME("Gfx_Ray r 0-40", N, Gfx_Ray(41, 47, (it % 181) - 90, 0, 40, GFX_INVERT));
+    TIME("Gfx_Arc r 40 half circle", N / 10, Gfx_Arc(41, 47, 40, -90, 90, GFX_SET));
+}
+
+int main(void) {
+    TestFills();
+    TestLines();
+    TestArcs();
+    if (!checkFailures) Bench();
+    return CHECK_DONE();
+}
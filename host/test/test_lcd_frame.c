@@ -0,0 +1,327 @@
+// test_lcd_frame.c
+// Host test for the double-buffered LCD driver (Nokia5110.c, compiled
+// unchanged as its own translation unit) and the frame helpers in
+// lcd_frame.h.
+//
+// The PCD8544 panel is modelled from what actually reaches SSI0: the SSI0
+// register page is mapped PROT_NONE, every access faults, and the fault
+// handler single-steps the access with the page open. A byte stored to
+// SSI0_DR (which otherwise holds a sentinel) is fed to the panel model
+// with the D/C pin level at that moment. The uDMA calls are stubs that
+// deliver their span to the panel when the test "completes" the transfer,
+// and SSI0 always reads as idle (TNF set, BSY clear, TXRIS set).
+//
+// The test draws random frames, hands them over with Nokia5110_SwapBuffers
+// and runs the SSI0/uDMA interrupts a random number of steps in between,
+// so swaps land before, during and after flushes. It checks that:
+//   - each swap happens only when the previous frame is whole on the panel
+//   - after the last flush the panel holds the last frame
+//   - the flush-complete callback runs once the panel is up to date
+//   - direct glass writes (GlassStale) are repaired by the next swap
+//   - Lcd_ShowText lays out wrapped text and '\n' rows
+//
+// x86-64 Linux only (single-step through EFLAGS.TF).
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+
+#include "lcd_frame.h"
+#include "check.h"
+
+#define SSI0_PAGE   0x40008000UL
+#define SSI0_DR     (*((volatile uint32_t *)0x40008008))
+#define SSI0_SR     (*((volatile uint32_t *)0x4000800C))
+#define SSI0_IM     (*((volatile uint32_t *)0x40008014))
+#define SSI0_RIS    (*((volatile uint32_t *)0x40008018))
+#define DC_PIN      (*((volatile uint32_t *)0x40004100))
+#define DR_EMPTY    0xFFFFFFFFu     // Sentinel: stored bytes are < 0x100
+#define EFLAGS_TF   0x100
+
+#define PANEL_BYTES (GFX_WIDTH * GFX_BANKS)
+
+void SSI0_Handler(void);            // Nokia5110.c
+
+// ==================== Panel Model ====================
+
+static uint8_t panel[PANEL_BYTES];
+static uint32_t panelX, panelY, panelExtended;
+static uint32_t panelDataBytes;
+
+static void Panel_Byte(uint32_t dc, uint8_t b) {
+    if (dc == 0) {                  // Command
+        if ((b & 0xF8) == 0x20) {
+            panelExtended = b & 1;  // Function set: H bit
+        } else if (!panelExtended && (b & 0x80)) {
+            panelX = b & 0x7F;
+            CHECK(panelX < GFX_WIDTH);
+        } else if (!panelExtended && (b & 0xC0) == 0x40) {
+            panelY = b & 0x07;
+            CHECK(panelY < GFX_BANKS);
+        }
+        return;
+    }
+    panel[GFX_WIDTH * panelY + panelX] = b;
+    panelDataBytes++;
+    if (++panelX == GFX_WIDTH) {    // Horizontal addressing
+        panelX = 0;
+        panelY = (panelY + 1) % GFX_BANKS;
+    }
+}
+
+// ==================== SSI0 Register Trap ====================
+
+static void OnFault(int sig, siginfo_t *info, void *context) {
+    uintptr_t addr = (uintptr_t)info->si_addr;
+    if (addr < SSI0_PAGE || addr >= SSI0_PAGE + 4096) {
+        signal(sig, SIG_DFL);       // A real crash: fault again, unhandled
+        return;
+    }
+    mprotect((void *)SSI0_PAGE, 4096, PROT_READ | PROT_WRITE);
+    ((ucontext_t *)context)->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+}
+
+static void OnStep(int sig, siginfo_t *info, void *context) {
+    (void)sig;
+    (void)info;
+    ((ucontext_t *)context)->uc_mcontext.gregs[REG_EFL] &= ~EFLAGS_TF;
+    if (SSI0_DR != DR_EMPTY) {
+        Panel_Byte(DC_PIN, (uint8_t)SSI0_DR);
+        SSI0_DR = DR_EMPTY;
+    }
+    mprotect((void *)SSI0_PAGE, 4096, PROT_NONE);
+}
+
+static void Trap_Start(void) {
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sa.sa_sigaction = OnFault;
+    sigaction(SIGSEGV, &sa, 0);
+    sa.sa_sigaction = OnStep;
+    sigaction(SIGTRAP, &sa, 0);
+
+    SSI0_DR = DR_EMPTY;
+    SSI0_SR = 0x00000002;           // TNF, never BSY
+    SSI0_RIS = 0x00000008;          // TXRIS: FIFO empty and idle
+    mprotect((void *)SSI0_PAGE, 4096, PROT_NONE);
+}
+
+// ==================== uDMA Stubs ====================
+
+static const uint8_t *dmaSrc;
+static uint32_t dmaBytes;
+static uint8_t dmaRunning, dmaDone;
+
+void Udma_Init(void) {
+}
+
+void Udma_ChannelInit(uint8_t channel) {
+    CHECK_EQ(channel, 11);
+}
+
+void Udma_StartToPeripheral(uint8_t channel, const void *src, volatile void *dst,
+                            uint32_t bytes, uint32_t arbSize) {
+    (void)arbSize;
+    CHECK_EQ(channel, 11);
+    CHECK(dst == (volatile void *)&SSI0_DR);
+    CHECK(!dmaRunning && bytes >= 1 && bytes <= GFX_WIDTH);
+    dmaSrc = src;
+    dmaBytes = bytes;
+    dmaRunning = 1;
+}
+
+uint8_t Udma_TakeDone(uint8_t channel) {
+    uint8_t done = dmaDone;
+    CHECK_EQ(channel, 11);
+    dmaDone = 0;
+    return done;
+}
+
+// One hardware event: the running transfer completes, or SSI0 reports idle.
+// Returns 0 when nothing is left to happen.
+static int Hardware_Step(void) {
+    if (dmaRunning) {
+        CHECK_EQ(DC_PIN, 0x40);     // D/C must stay high for the whole span
+        for (uint32_t i = 0; i < dmaBytes; i++) Panel_Byte(DC_PIN, dmaSrc[i]);
+        dmaRunning = 0;
+        dmaDone = 1;
+        SSI0_Handler();             // Channel done raises the SSI0 interrupt
+        return 1;
+    }
+    if (SSI0_IM & 0x08) {
+        SSI0_Handler();
+        return 1;
+    }
+    return 0;
+}
+
+static uint32_t flushesDone;
+
+// Flush-complete callback: nothing is left to send
+static void FlushDone(void *arg) {
+    (void)arg;
+    CHECK(!Nokia5110_FlushBusy());
+    flushesDone++;
+}
+
+static void Hardware_Drain(void) {
+    uint32_t before = flushesDone;
+    int busy = Nokia5110_FlushBusy();
+
+    for (int i = 0; i < 100000 && Hardware_Step(); i++);
+    CHECK(!Nokia5110_FlushBusy());
+    if (busy) CHECK(flushesDone > before);          // Lcd_Flush would wake
+}
+
+// ==================== Frames ====================
+
+#define FRAMES 3000
+
+static uint8_t frames[2][PANEL_BYTES];   // Last two frames handed over
+static uint32_t swapsDone;
+static uint8_t glassWritten;
+
+static void Swapped(void *arg) {
+    uint32_t n = (uint32_t)(uintptr_t)arg;
+    CHECK_EQ(n, swapsDone);
+    // The previous frame finished streaming before this swap, unless text
+    // was written straight to the glass since
+    if (n > 0 && !glassWritten) CHECK(memcmp(panel, frames[(n - 1) & 1], PANEL_BYTES) == 0);
+    glassWritten = 0;
+    // Screen starts as a copy of the frame just handed over
+    CHECK(memcmp(Screen, frames[n & 1], PANEL_BYTES) == 0);
+    swapsDone++;
+}
+
+static uint32_t rng = 5110;
+
+static uint32_t Random(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+// A frame that changes a few pixels, lines or boxes, or everything
+static void DrawSomething(void) {
+    switch (Random() % 8) {
+    case 0:
+        break;                                      // Same frame again
+    case 1:
+        Nokia5110_ClearBuffer();
+        Gfx_FillRect(0, 0, GFX_WIDTH - 1, GFX_HEIGHT - 1, GFX_INVERT);
+        break;
+    case 2:
+    case 3:
+        for (int k = Random() % 20; k > 0; k--) {
+            Nokia5110_SetPxl(Random() % GFX_HEIGHT, Random() % GFX_WIDTH);
+            Nokia5110_ClrPxl(Random() % GFX_HEIGHT, Random() % GFX_WIDTH);
+        }
+        break;
+    case 4:
+        Gfx_Line(Random() % 120 - 20, Random() % 80 - 16, Random() % 120 - 20, Random() % 80 - 16,
+                 (uint8_t)(Random() % 3));
+        break;
+    case 5:
+        Gfx_Pixel(Random() % GFX_WIDTH, Random() % GFX_HEIGHT, GFX_INVERT);
+        Gfx_Pixel(Random() % GFX_WIDTH, Random() % GFX_HEIGHT, GFX_INVERT);   // May undo it
+        break;
+    default:
+        Gfx_FillRect(Random() % GFX_WIDTH, Random() % GFX_HEIGHT, Random() % GFX_WIDTH,
+                     Random() % GFX_HEIGHT, (uint8_t)(Random() % 3));
+        break;
+    }
+}
+
+static void TestSwaps(void) {
+    uint32_t sent = panelDataBytes;
+
+    for (uint32_t n = 0; n < FRAMES && !checkFailures; n++) {
+        DrawSomething();
+        memcpy(frames[n & 1], Screen, PANEL_BYTES);
+        CHECK(Nokia5110_SwapBuffers(Swapped, (void *)(uintptr_t)n));
+        if (swapsDone <= n) CHECK(!Nokia5110_SwapBuffers(Swapped, 0));   // One pending at most
+
+        for (int k = Random() % 12; k > 0; k--) Hardware_Step();
+        while (swapsDone <= n) {                    // Lcd_BeginFrame
+            CHECK(Hardware_Step());
+            if (checkFailures) return;
+        }
+
+        if (Random() % 200 == 0 && n + 1 < FRAMES) {
+            Hardware_Drain();                       // Blocking calls wait for the flush
+            Nokia5110_SetCursor(Random() % 12, Random() % 6);
+            Nokia5110_OutString("glass");           // Straight to the panel
+            glassWritten = 1;
+        }
+    }
+    Hardware_Drain();
+    CHECK(memcmp(panel, frames[(FRAMES - 1) & 1], PANEL_BYTES) == 0);
+    printf("host: %u frames, %u data bytes on the wire (%u per frame, full frame %u)\n",
+           FRAMES, panelDataBytes - sent, (panelDataBytes - sent) / FRAMES, PANEL_BYTES);
+}
+
+// The blocking path reaches the same panel
+static void TestDisplayBuffer(void) {
+    Hardware_Drain();
+    Nokia5110_ClearBuffer();
+    Gfx_Line(0, 0, GFX_WIDTH - 1, GFX_HEIGHT - 1, GFX_SET);
+    Nokia5110_DisplayBuffer();
+    CHECK(memcmp(panel, Screen, PANEL_BYTES) == 0);
+    Nokia5110_Clear();                              // Glass only
+    Nokia5110_DisplayBuffer();                      // Nothing drawn, but the glass is stale
+    CHECK(memcmp(panel, Screen, PANEL_BYTES) == 0);
+}
+
+// Lcd_ShowText against the same characters placed by hand
+static void CheckText(const char *text, const char *const *rows) {
+    uint8_t shown[PANEL_BYTES];
+
+    Hardware_Drain();
+    Lcd_ShowText(text);                             // Kernel not running: blocking flush
+    memcpy(shown, panel, PANEL_BYTES);
+    Nokia5110_ClearBuffer();
+    for (int32_t row = 0; rows[row]; row++) {
+        for (int32_t column = 0; rows[row][column]; column++) {
+            Font_DrawChar(&font5x8, 7 * column + 1, 8 * row, rows[row][column], GFX_SET);
+        }
+    }
+    if (memcmp(shown, Screen, PANEL_BYTES) != 0) {
+        fprintf(stderr, "Lcd_ShowText(\"%s\") layout differs\n", text);
+        checkFailures++;
+    }
+}
+
+static void TestShowText(void) {
+    static const char *const limit[] = { "Limit: 25", 0 };
+    static const char *const object[] = { "Avg Angle: -", "45", "Dist: 30 cm", 0 };
+    static const char *const full[] = { "123456789012", "ab", 0 };
+    static const char *const blank[] = { "a", "", "b", 0 };
+    static const char *const clipped[] = { "1", "2", "3", "4", "5", "6", 0 };
+
+    CheckText("Limit: 25", limit);
+    CheckText("Avg Angle: -45\nDist: 30 cm", object);
+    CheckText("123456789012\nab", full);            // No blank row after a full one
+    CheckText("a\n\nb", blank);
+    CheckText("1\n2\n3\n4\n5\n6\n7", clipped);      // Rows past the screen are dropped
+}
+
+int main(void) {
+    Trap_Start();
+    Nokia5110_Init();
+    CHECK_EQ(panelExtended, 0);
+    Nokia5110_ClearBuffer();
+    Nokia5110_DisplayBuffer();                      // GlassStale: whole frame
+    CHECK_EQ(panelDataBytes, PANEL_BYTES);
+    for (int i = 0; i < PANEL_BYTES; i++) CHECK_EQ(panel[i], 0);
+
+    Nokia5110_OnFlushDone(FlushDone, 0);
+    TestSwaps();
+    TestDisplayBuffer();
+    TestShowText();
+    return CHECK_DONE();
+}
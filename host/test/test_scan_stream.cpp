@@ -0,0 +1,166 @@
+// test_scan_stream.cpp
+// Round trip of the scan streaming protocol: packets built by the firmware
+// encoder (scan_stream.h, compiled as is) are fed through the host decoder
+// (scan_protocol.h) that scan_receiver and scan_archive use.
+//
+// printChar is captured into a byte stream, mixed with the text, log and
+// broken frames a real UART0 stream carries, and every field must come back
+// as sent. Fields are drawn to hit 0x00 and 0xFF bytes, which COBS has to
+// escape, and negative values.
+
+#define PRINT_HELPER_H                  // Capture printChar, not the UART0 driver
+extern "C" void printChar(char c);
+
+extern "C" {
+#include "scan_stream.h"
+#include "check.h"
+}
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "scan_protocol.h"
+
+static std::vector<uint8_t> wire;
+
+extern "C" void printChar(char c) {
+    wire.push_back(uint8_t(c));
+}
+
+static uint32_t rng = 17;
+
+static uint32_t Random(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+// Mostly awkward bytes: 0x00 and 0xFF runs, otherwise random
+static uint32_t RandomField(void) {
+    switch (Random() % 4) {
+    case 0:  return 0;
+    case 1:  return 0xFFFFFFFF;
+    case 2:  return Random() & 0x00FF00FF;
+    default: return Random();
+    }
+}
+
+static void Junk(void) {
+    static const char *const text[] = { "Temp: 23.45\r\n", "I APP scan done\r\n", "\x02\x01" };
+    const char *s = text[Random() % 3];
+    wire.insert(wire.end(), s, s + strlen(s));
+}
+
+// Every packet type with random fields, between junk, decodes to the same fields
+static void TestRoundTrip(void) {
+    enum { PACKETS = 20000 };
+    std::vector<scan::Packet> sent;
+    scan::FrameReader reader;
+    size_t received = 0;
+
+    wire.clear();
+    for (int i = 0; i < PACKETS; i++) {
+        scan::Packet p = scan::Packet();
+        p.type = uint8_t(1 + Random() % 3);
+        p.scanId = RandomField();
+        if (p.type == scan::kPacketBegin) {
+            float temperature = int16_t(RandomField()) / 100.0f;
+            p.startUs = RandomField();
+            p.tempCentiC = int16_t(std::lround(temperature * 100.0f));
+            p.fromDeg = int16_t(RandomField());
+            p.toDeg = int16_t(RandomField());
+            p.bins = uint16_t(RandomField());
+            ScanStream_Begin(p.scanId, p.startUs, temperature, p.fromDeg, p.toDeg, p.bins);
+        } else if (p.type == scan::kPacketBin) {
+            p.bin = uint16_t(RandomField());
+            p.angleDeg = int16_t(RandomField());
+            p.distanceCm = uint16_t(RandomField());
+            p.timeUs = RandomField();
+            ScanStream_Bin(p.scanId, p.bin, p.angleDeg, p.distanceCm, p.timeUs);
+        } else {
+            p.bins = uint16_t(RandomField());
+            p.detected = uint8_t(RandomField());
+            p.angleDeg = int16_t(RandomField());
+            p.distanceCm = uint16_t(RandomField());
+            ScanStream_End(p.scanId, p.bins, p.detected, p.angleDeg, p.distanceCm);
+        }
+        sent.push_back(p);
+        if (Random() % 4 == 0) Junk();
+    }
+
+    // Fed in random slices, as reads from the serial port arrive
+    for (size_t at = 0; at < wire.size();) {
+        size_t n = std::min<size_t>(1 + Random() % 64, wire.size() - at);
+        reader.Feed(wire.data() + at, n, [&](const scan::Packet &got) {
+            if (received >= sent.size()) {
+                checkFailures++;
+                return;
+            }
+            const scan::Packet &want = sent[received++];
+            CHECK_EQ(got.type, want.type);
+            CHECK_EQ(got.scanId, want.scanId);
+            CHECK_EQ(got.startUs, want.startUs);
+            CHECK_EQ(got.tempCentiC, want.tempCentiC);
+            CHECK_EQ(got.fromDeg, want.fromDeg);
+            CHECK_EQ(got.toDeg, want.toDeg);
+            CHECK_EQ(got.bins, want.bins);
+            CHECK_EQ(got.bin, want.bin);
+            CHECK_EQ(got.timeUs, want.timeUs);
+            CHECK_EQ(got.angleDeg, want.angleDeg);
+            CHECK_EQ(got.distanceCm, want.distanceCm);
+            CHECK_EQ(got.detected, want.detected);
+        });
+        at += n;
+        if (checkFailures) return;
+    }
+    CHECK_EQ(received, PACKETS);
+    CHECK_EQ(reader.packets, PACKETS);
+}
+
+// A frame with any one byte changed is rejected, not misread
+static void TestCorruption(void) {
+    int accepted = 0;
+
+    for (int i = 0; i < 5000; i++) {
+        scan::FrameReader reader;
+        wire.clear();
+        ScanStream_Bin(Random(), uint16_t(Random()), int16_t(Random()), uint16_t(Random()), Random());
+        size_t at = 1 + Random() % (wire.size() - 2);   // Inside the frame
+        wire[at] ^= uint8_t(1 + Random() % 255);
+        if (wire[at] == 0) wire[at] = 0x5A;             // Keep the frame whole
+        reader.Feed(wire.data(), wire.size(), [&](const scan::Packet &) { accepted++; });
+        CHECK_EQ(reader.packets + reader.badFrames, 1);
+    }
+    CHECK_EQ(accepted, 0);
+}
+
+// COBS blocks longer than 254 bytes, and runs of zeros
+static void TestCobs(void) {
+    uint8_t src[1000], enc[1000 + 1000 / 254 + 1];
+    std::vector<uint8_t> dec;
+
+    for (int i = 0; i < 2000; i++) {
+        uint32_t len = Random() % sizeof(src);
+        uint32_t zeroOdds = 1 + Random() % 600;
+        for (uint32_t k = 0; k < len; k++) {
+            src[k] = (Random() % zeroOdds == 0) ? 0 : uint8_t(1 + Random() % 255);
+        }
+        uint32_t n = Cobs_Encode(src, len, enc);
+        CHECK(n <= len + len / 254 + 1);
+        CHECK(memchr(enc, 0, n) == 0);
+        CHECK(scan::CobsDecode(enc, n, dec));
+        CHECK(dec.size() == len && memcmp(dec.data(), src, len) == 0);
+        if (checkFailures) return;
+    }
+    CHECK_EQ(Crc16_Ccitt((const uint8_t *)"123456789", 9), 0x29B1);   // CCITT-FALSE check value
+}
+
+int main(void) {
+    TestRoundTrip();
+    TestCorruption();
+    TestCobs();
+    return CHECK_DONE();
+}
@@ -0,0 +1,225 @@
+// test_soft_timer.c
+// Host test for the delta-list soft timer service (soft_timer.h).
+//
+// TIMER4_TAR_R is plain memory here, so the test moves time by writing it
+// and plays the match interrupt by calling TIMER4A_Handler(). A reference
+// model of absolute expiries checks the delta list after every operation.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "soft_timer.h"
+#include "check.h"
+
+#define TIMERS 8
+
+static SoftTimer timers[TIMERS];
+static int fired[64];              // Timer indices in callback order
+static int firedCount;
+static uint32_t firedAt[TIMERS];   // softTimerBase when each timer last fired
+
+static void Record(void *arg) {
+    int i = (int)(intptr_t)arg;
+    if (firedCount < 64) fired[firedCount++] = i;
+    firedAt[i] = softTimerBase;
+}
+
+static void Reset(uint32_t now) {
+    memset(timers, 0, sizeof(timers));
+    TIMER4_IMR_R = 0;
+    softTimerHead = 0;
+    softTimerBase = 0;
+    firedCount = 0;
+    NVIC_ClearPendingIRQ(TIMER4A_IRQn);
+    TIMER4_TAR_R = now;
+}
+
+static void Start(int i, uint32_t delay, uint32_t period) {
+    SoftTimer_Start(&timers[i], delay, period, Record, (void *)(intptr_t)i);
+}
+
+// Run the ISR as the hardware would at tick now
+static void RunTo(uint32_t now) {
+    TIMER4_TAR_R = now;
+    TIMER4A_Handler();
+}
+
+// Absolute expiry of a linked timer, walking the delta list
+static uint32_t Expiry(const SoftTimer *timer) {
+    uint32_t at = softTimerBase;
+    for (const SoftTimer *node = softTimerHead; node; node = node->next) {
+        at += node->delta;
+        if (node == timer) return at;
+    }
+    return 0;
+}
+
+static int ListLength(void) {
+    int n = 0;
+    for (const SoftTimer *node = softTimerHead; node; node = node->next) n++;
+    return n;
+}
+
+// Match register, interrupt mask and active flags agree with the list
+static void CheckArmed(void) {
+    if (softTimerHead) {
+        CHECK_EQ(TIMER4_TAMATCHR_R, softTimerBase + softTimerHead->delta);
+        CHECK(TIMER4_IMR_R & TIMER_IMR_TAMIM);
+    } else {
+        CHECK(!(TIMER4_IMR_R & TIMER_IMR_TAMIM));
+    }
+    int active = 0;
+    for (int i = 0; i < TIMERS; i++) active += timers[i].active;
+    CHECK_EQ(active, ListLength());
+}
+
+// Expiries are absolute from the start tick, ties fire in start order
+static void TestOrder(void) {
+    Reset(1000);
+    Start(0, 5000, 0);
+    Start(1, 2000, 0);
+    Start(2, 5000, 0);   // Same expiry as 0: fires after it
+    Start(3, 100000, 0);
+    CheckArmed();
+    CHECK_EQ(Expiry(&timers[1]), 3000);
+    CHECK_EQ(Expiry(&timers[0]), 6000);
+    CHECK_EQ(Expiry(&timers[2]), 6000);
+    CHECK_EQ(Expiry(&timers[3]), 101000);
+
+    RunTo(2999);         // Early match: nothing due
+    CHECK_EQ(firedCount, 0);
+    RunTo(3000);
+    CHECK_EQ(firedCount, 1);
+    CHECK_EQ(fired[0], 1);
+    RunTo(7000);         // Late: both due timers run, oldest first
+    CHECK_EQ(firedCount, 3);
+    CHECK_EQ(fired[1], 0);
+    CHECK_EQ(fired[2], 2);
+    CHECK_EQ(firedAt[2], 6000);
+    CheckArmed();
+    CHECK_EQ(Expiry(&timers[3]), 101000);
+}
+
+// Stopping a timer hands its delta on; restarting relinks it
+static void TestStop(void) {
+    Reset(0);
+    Start(0, 1000, 0);
+    Start(1, 3000, 0);
+    Start(2, 6000, 0);
+    SoftTimer_Stop(&timers[1]);
+    CHECK(!timers[1].active);
+    CHECK_EQ(Expiry(&timers[2]), 6000);
+    SoftTimer_Stop(&timers[1]);       // Not running: no effect
+    SoftTimer_Stop(&timers[0]);       // Head: base stays, successor absorbs
+    CHECK_EQ(Expiry(&timers[2]), 6000);
+    CheckArmed();
+
+    TIMER4_TAR_R = 2000;
+    Start(2, 500, 0);                 // Restart moves it
+    CHECK_EQ(Expiry(&timers[2]), 2500);
+    CHECK_EQ(ListLength(), 1);
+    SoftTimer_Stop(&timers[2]);
+    CheckArmed();
+    CHECK_EQ(softTimerHead, 0);
+}
+
+// Periodic reloads are relative to the nominal expiry: a late ISR does not
+// shift later expiries
+static void TestPeriodic(void) {
+    Reset(0);
+    Start(0, 1000, 1000);
+    RunTo(1000);
+    RunTo(2400);                      // 400 ticks late
+    RunTo(3000);
+    CHECK_EQ(firedCount, 3);
+    CHECK_EQ(firedAt[0], 3000);
+    CHECK_EQ(Expiry(&timers[0]), 4000);
+    RunTo(7500);                      // Several periods late: catches up in one ISR
+    CHECK_EQ(firedCount, 7);
+    CHECK_EQ(Expiry(&timers[0]), 8000);
+    SoftTimer_Stop(&timers[0]);
+    CheckArmed();
+}
+
+// Expiries across the 32-bit wrap of the free-running counter
+static void TestWrap(void) {
+    Reset(0xFFFFF000u);
+    Start(0, 0x2000, 0);              // Expires at 0x1000 after the wrap
+    Start(1, 0x800, 0);               // Before the wrap
+    CHECK_EQ(TIMER4_TAMATCHR_R, 0xFFFFF800u);
+    RunTo(0xFFFFFFFFu);
+    CHECK_EQ(firedCount, 1);
+    CHECK_EQ(TIMER4_TAMATCHR_R, 0x1000);
+    RunTo(0x0FFF);
+    CHECK_EQ(firedCount, 1);
+    RunTo(0x1000);
+    CHECK_EQ(firedCount, 2);
+    CheckArmed();
+}
+
+// A head too close for the match compare is pended in software
+static void TestMinTicks(void) {
+    Reset(500);
+    Start(0, SOFTTIMER_MIN_TICKS - 1, 0);
+    CHECK(NVIC_GetPendingIRQ(TIMER4A_IRQn));
+    Reset(500);
+    Start(0, SOFTTIMER_MIN_TICKS, 0);
+    CHECK(!NVIC_GetPendingIRQ(TIMER4A_IRQn));
+    CHECK_EQ(SOFTTIMER_TICKS_PER_MS, 80000);   // 80 MHz
+}
+
+// Random starts, stops and ISR runs against a model of absolute expiries
+static void TestRandom(void) {
+    uint32_t now = 0x7FFF0000u;
+    uint32_t due[TIMERS];
+    uint8_t on[TIMERS] = {0};
+
+    Reset(now);
+    srand(1);
+    for (int step = 0; step < 20000; step++) {
+        int i = rand() % TIMERS;
+        switch (rand() % 4) {
+        case 0:
+        case 1: {
+            uint32_t delay = (uint32_t)(rand() % 50000);
+            TIMER4_TAR_R = now;
+            Start(i, delay, 0);
+            due[i] = now + delay;
+            on[i] = 1;
+            break;
+        }
+        case 2:
+            SoftTimer_Stop(&timers[i]);
+            on[i] = 0;
+            break;
+        default:
+            now += (uint32_t)(rand() % 20000);
+            firedCount = 0;
+            RunTo(now);
+            for (int k = 0; k < firedCount; k++) {
+                int t = fired[k];
+                CHECK(on[t]);
+                CHECK((int32_t)(now - due[t]) >= 0);
+                CHECK_EQ(firedAt[t], due[t]);   // Base lands on the exact expiry
+                on[t] = 0;
+            }
+            break;
+        }
+        for (int k = 0; k < TIMERS; k++) {
+            CHECK_EQ(timers[k].active, on[k]);
+            if (on[k]) CHECK_EQ(Expiry(&timers[k]), due[k]);
+        }
+        CheckArmed();
+        if (checkFailures) return;      // One report, not thousands
+    }
+}
+
+int main(void) {
+    TestOrder();
+    TestStop();
+    TestPeriodic();
+    TestWrap();
+    TestMinTicks();
+    TestRandom();
+    return CHECK_DONE();
+}